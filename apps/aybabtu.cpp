@@ -0,0 +1,606 @@
+// Copyright (c) Steinwurf ApS 2016.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+// A base64 transcoder for files and pipes, in the spirit of coreutils
+// base64. Regular files are memory-mapped, and a regular output file is
+// mapped and written in place, so the data is only touched by the codec.
+
+#include <aybabtu/base64.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace
+{
+const char* const usage =
+    "Usage: aybabtu [OPTION]... [INPUT [OUTPUT]]\n"
+    "Base64 encode or decode INPUT, or standard input, to OUTPUT, or\n"
+    "standard output. A missing INPUT or OUTPUT, or '-', means the\n"
+    "standard stream.\n"
+    "\n"
+    "  -d, --decode         decode data; whitespace is ignored\n"
+    "  -u, --url            use the URL and filename safe alphabet\n"
+    "  -n, --no-padding     do not write or expect '=' padding\n"
+    "  -w, --wrap=COLS      wrap encoded lines after COLS characters,\n"
+    "                       76 by default. 0 disables wrapping\n"
+    "  -t, --threads=N      use N threads for inputs of 4 MiB or more, 0\n"
+    "                       for one per core. 1 by default. Decoding\n"
+    "                       input with line breaks uses one thread\n"
+    "  -s, --simd=NAME      use the given acceleration: auto, none, ssse3,\n"
+    "                       avx2, neon, avx512_vbmi, avx512_bw or\n"
+    "                       avx512_vl. auto by default\n"
+    "  -v, --verbose        print the throughput and the acceleration to\n"
+    "                       standard error\n"
+    "  -h, --help           print this help and exit\n";
+
+// The names of the simd values, in declaration order:
+const char* const simd_names[] = {"auto", "none",        "ssse3",
+                                  "avx2", "neon",        "avx512_vbmi",
+                                  "avx512_bw", "avx512_vl"};
+
+struct options
+{
+    bool decode = false;
+    aybabtu::alphabet alphabet = aybabtu::alphabet::standard;
+    aybabtu::padding padding = aybabtu::padding::enabled;
+    std::size_t wrap = 76;
+    std::size_t threads = 1;
+    aybabtu::simd simd = aybabtu::simd::auto_;
+    bool verbose = false;
+    const char* input = "-";
+    const char* output = "-";
+};
+
+[[noreturn]] void fail(const char* message, const char* detail = nullptr)
+{
+    if (detail != nullptr)
+    {
+        std::fprintf(stderr, "aybabtu: %s: %s\n", message, detail);
+    }
+    else
+    {
+        std::fprintf(stderr, "aybabtu: %s\n", message);
+    }
+    std::exit(1);
+}
+
+std::size_t parse_count(const char* value, const char* option)
+{
+    char* end = nullptr;
+    errno = 0;
+    unsigned long long count = std::strtoull(value, &end, 10);
+    if (*value == '\0' || *end != '\0' || errno != 0 || *value == '-')
+    {
+        fail("invalid number for option", option);
+    }
+    return static_cast<std::size_t>(count);
+}
+
+aybabtu::simd parse_simd(const char* value)
+{
+    for (std::size_t i = 0; i < sizeof(simd_names) / sizeof(simd_names[0]);
+         ++i)
+    {
+        if (std::strcmp(value, simd_names[i]) == 0)
+        {
+            // An explicitly requested acceleration is used without checking
+            // the CPU, so check it here rather than fail with an illegal
+            // instruction:
+            const auto simd = static_cast<aybabtu::simd>(i);
+            if (!aybabtu::base64::is_supported(simd))
+            {
+                fail("acceleration not supported by this CPU", value);
+            }
+            return simd;
+        }
+    }
+    fail("unknown acceleration", value);
+}
+
+// Match an option in either the "-x VALUE", "-xVALUE", "--name=VALUE" or
+// "--name VALUE" form, and return its value.
+bool match_value(int argc, char** argv, int& i, const char* short_name,
+                 const char* long_name, const char** value)
+{
+    const char* arg = argv[i];
+    const std::size_t length = std::strlen(long_name);
+
+    if (std::strcmp(arg, short_name) == 0 || std::strcmp(arg, long_name) == 0)
+    {
+        if (i + 1 >= argc)
+        {
+            fail("missing value for option", arg);
+        }
+        *value = argv[++i];
+        return true;
+    }
+    if (std::strncmp(arg, long_name, length) == 0 && arg[length] == '=')
+    {
+        *value = arg + length + 1;
+        return true;
+    }
+    if (std::strncmp(arg, short_name, 2) == 0 && arg[2] != '\0')
+    {
+        *value = arg + 2;
+        return true;
+    }
+    return false;
+}
+
+options parse(int argc, char** argv)
+{
+    options result;
+    int positional = 0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const char* arg = argv[i];
+        const char* value = nullptr;
+
+        if (std::strcmp(arg, "-h") == 0 || std::strcmp(arg, "--help") == 0)
+        {
+            std::fputs(usage, stdout);
+            std::exit(0);
+        }
+        else if (std::strcmp(arg, "-d") == 0 ||
+                 std::strcmp(arg, "--decode") == 0)
+        {
+            result.decode = true;
+        }
+        else if (std::strcmp(arg, "-u") == 0 || std::strcmp(arg, "--url") == 0)
+        {
+            result.alphabet = aybabtu::alphabet::url;
+        }
+        else if (std::strcmp(arg, "-n") == 0 ||
+                 std::strcmp(arg, "--no-padding") == 0)
+        {
+            result.padding = aybabtu::padding::disabled;
+        }
+        else if (std::strcmp(arg, "-v") == 0 ||
+                 std::strcmp(arg, "--verbose") == 0)
+        {
+            result.verbose = true;
+        }
+        else if (match_value(argc, argv, i, "-w", "--wrap", &value))
+        {
+            result.wrap = parse_count(value, "--wrap");
+        }
+        else if (match_value(argc, argv, i, "-t", "--threads", &value))
+        {
+            result.threads = parse_count(value, "--threads");
+        }
+        else if (match_value(argc, argv, i, "-s", "--simd", &value))
+        {
+            result.simd = parse_simd(value);
+        }
+        else if (arg[0] == '-' && arg[1] != '\0')
+        {
+            std::fputs(usage, stderr);
+            fail("unknown option", arg);
+        }
+        else if (positional == 0)
+        {
+            result.input = arg;
+            positional++;
+        }
+        else if (positional == 1)
+        {
+            result.output = arg;
+            positional++;
+        }
+        else
+        {
+            fail("extra operand", arg);
+        }
+    }
+    return result;
+}
+
+// The input, either mapped from a regular file or read into memory from a
+// pipe or terminal.
+class input_data
+{
+public:
+    explicit input_data(const char* path)
+    {
+        m_fd = std::strcmp(path, "-") == 0 ? STDIN_FILENO
+                                           : ::open(path, O_RDONLY);
+        if (m_fd < 0)
+        {
+            fail(path, std::strerror(errno));
+        }
+
+        if (::fstat(m_fd, &m_info) != 0)
+        {
+            fail(path, std::strerror(errno));
+        }
+
+        // Standard input may be a regular file that is already partly read,
+        // so the data starts at the current position, which is 0 for a file
+        // opened here. The mapping has to start on a page boundary.
+        const off_t position = ::lseek(m_fd, 0, SEEK_CUR);
+        if (S_ISREG(m_info.st_mode) && position >= 0 &&
+            m_info.st_size > position)
+        {
+            const off_t page = static_cast<off_t>(::sysconf(_SC_PAGESIZE));
+            const off_t start = position / page * page;
+            m_map_size = static_cast<std::size_t>(m_info.st_size - start);
+            void* data = ::mmap(nullptr, m_map_size, PROT_READ, MAP_PRIVATE,
+                                m_fd, start);
+            if (data != MAP_FAILED)
+            {
+                // The codecs read the input once, front to back:
+                ::madvise(data, m_map_size, MADV_SEQUENTIAL);
+                m_map = data;
+                m_data = static_cast<const uint8_t*>(data) + (position - start);
+                m_size = static_cast<std::size_t>(m_info.st_size - position);
+                return;
+            }
+        }
+        read_all(path);
+    }
+
+    ~input_data()
+    {
+        if (m_map != nullptr)
+        {
+            ::munmap(m_map, m_map_size);
+        }
+        else
+        {
+            std::free(const_cast<uint8_t*>(m_data));
+        }
+        if (m_fd != STDIN_FILENO)
+        {
+            ::close(m_fd);
+        }
+    }
+
+    input_data(const input_data&) = delete;
+    input_data& operator=(const input_data&) = delete;
+
+    const uint8_t* data() const
+    {
+        return m_data;
+    }
+
+    std::size_t size() const
+    {
+        return m_size;
+    }
+
+    /// @return true if the input is a regular file and fd refers to it
+    bool is_same_file(int fd) const
+    {
+        struct stat info;
+        return S_ISREG(m_info.st_mode) && ::fstat(fd, &info) == 0 &&
+               info.st_dev == m_info.st_dev && info.st_ino == m_info.st_ino;
+    }
+
+private:
+    void read_all(const char* path)
+    {
+        std::size_t capacity = 1 << 20;
+        uint8_t* buffer = static_cast<uint8_t*>(std::malloc(capacity));
+
+        while (buffer != nullptr)
+        {
+            if (m_size == capacity)
+            {
+                capacity *= 2;
+                uint8_t* larger =
+                    static_cast<uint8_t*>(std::realloc(buffer, capacity));
+                if (larger == nullptr)
+                {
+                    std::free(buffer);
+                    buffer = nullptr;
+                    break;
+                }
+                buffer = larger;
+            }
+
+            ssize_t n = ::read(m_fd, buffer + m_size, capacity - m_size);
+            if (n < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if (n < 0)
+            {
+                fail(path, std::strerror(errno));
+            }
+            if (n == 0)
+            {
+                m_data = buffer;
+                return;
+            }
+            m_size += static_cast<std::size_t>(n);
+        }
+        fail(path, "out of memory");
+    }
+
+    int m_fd = -1;
+    struct stat m_info;
+    const uint8_t* m_data = nullptr;
+    std::size_t m_size = 0;
+    void* m_map = nullptr;
+    std::size_t m_map_size = 0;
+};
+
+// The output, either a regular file that is sized up front and mapped, or
+// a page aligned buffer that is written to a pipe or terminal at the end.
+class output_data
+{
+public:
+    output_data(const char* path, std::size_t capacity,
+                const input_data& input) :
+        m_path(path), m_capacity(capacity)
+    {
+        if (std::strcmp(path, "-") != 0)
+        {
+            // Not truncated before checking that it is not the input, which
+            // may be mapped:
+            m_fd = ::open(path, O_RDWR | O_CREAT, 0666);
+            if (m_fd < 0)
+            {
+                fail(path, std::strerror(errno));
+            }
+            if (input.is_same_file(m_fd))
+            {
+                fail(path, "input file is output file");
+            }
+
+            struct stat info;
+            const bool regular =
+                ::fstat(m_fd, &info) == 0 && S_ISREG(info.st_mode);
+            if (regular && ::ftruncate(m_fd, 0) != 0)
+            {
+                fail(path, std::strerror(errno));
+            }
+            if (m_capacity > 0 && regular &&
+                ::ftruncate(m_fd, static_cast<off_t>(m_capacity)) == 0)
+            {
+                void* data = ::mmap(nullptr, m_capacity, PROT_READ | PROT_WRITE,
+                                    MAP_SHARED, m_fd, 0);
+                if (data != MAP_FAILED)
+                {
+                    m_data = static_cast<uint8_t*>(data);
+                    m_mapped = true;
+                    return;
+                }
+            }
+        }
+        else
+        {
+            m_fd = STDOUT_FILENO;
+            if (input.is_same_file(m_fd))
+            {
+                fail("standard output", "input file is output file");
+            }
+        }
+
+        void* data = nullptr;
+        if (::posix_memalign(&data, 4096, m_capacity + 1) != 0)
+        {
+            fail(path, "out of memory");
+        }
+        m_data = static_cast<uint8_t*>(data);
+    }
+
+    ~output_data()
+    {
+        if (m_mapped)
+        {
+            ::munmap(m_data, m_capacity);
+        }
+        else
+        {
+            std::free(m_data);
+        }
+        if (m_fd != STDOUT_FILENO)
+        {
+            ::close(m_fd);
+        }
+    }
+
+    output_data(const output_data&) = delete;
+    output_data& operator=(const output_data&) = delete;
+
+    uint8_t* data()
+    {
+        return m_data;
+    }
+
+    /// Write the first size bytes of the output
+    void commit(std::size_t size)
+    {
+        if (m_mapped)
+        {
+            if (::ftruncate(m_fd, static_cast<off_t>(size)) != 0)
+            {
+                fail(m_path, std::strerror(errno));
+            }
+            return;
+        }
+
+        const uint8_t* it = m_data;
+        while (size > 0)
+        {
+            ssize_t n = ::write(m_fd, it, size);
+            if (n < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if (n < 0)
+            {
+                fail(m_path, std::strerror(errno));
+            }
+            it += n;
+            size -= static_cast<std::size_t>(n);
+        }
+    }
+
+private:
+    const char* m_path;
+    int m_fd = -1;
+    uint8_t* m_data = nullptr;
+    std::size_t m_capacity = 0;
+    bool m_mapped = false;
+};
+
+// The threads that encode and decode use for an input of the given size.
+std::size_t threads_used(std::size_t size)
+{
+    return size >= aybabtu::base64::thread_threshold()
+               ? aybabtu::base64::threads()
+               : 1;
+}
+
+std::size_t encode(const options& options, const input_data& input,
+                   output_data& output, std::size_t& threads)
+{
+    threads = threads_used(input.size());
+
+    char* out = reinterpret_cast<char*>(output.data());
+    std::size_t written = 0;
+
+    if (input.size() == 0)
+    {
+        return 0;
+    }
+    if (options.wrap == 0)
+    {
+        written =
+            aybabtu::base64::encode(input.data(), input.size(), out,
+                                    options.alphabet, options.padding,
+                                    options.simd);
+    }
+    else
+    {
+        written = aybabtu::base64::encode(
+            input.data(), input.size(), out, options.alphabet,
+            options.padding, options.wrap, aybabtu::line_break::lf,
+            options.simd);
+    }
+
+    // Like coreutils, wrapped output ends with a line break:
+    if (options.wrap != 0)
+    {
+        out[written++] = '\n';
+    }
+    return written;
+}
+
+bool is_space(uint8_t c)
+{
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+std::size_t decode(const options& options, const input_data& input,
+                   output_data& output, std::size_t& threads)
+{
+    const char* string = reinterpret_cast<const char*>(input.data());
+    std::size_t size = input.size();
+
+    // The trailing line break is common enough to not take the slower path
+    // that ignores whitespace:
+    while (size > 0 && is_space((uint8_t)string[size - 1]))
+    {
+        size--;
+    }
+
+    // Decode the string as it is, which uses every thread. If this stops at
+    // whitespace, or at the end because the size includes whitespace, the
+    // string is wrapped and is decoded again ignoring it, on one thread.
+    // This costs little since the first line break comes early.
+    threads = threads_used(size);
+    std::error_code error;
+    std::size_t error_offset = 0;
+    std::size_t written = aybabtu::base64::decode(
+        string, size, output.data(), error, error_offset, options.alphabet,
+        options.padding, options.simd);
+
+    if (error &&
+        (error_offset == size || is_space((uint8_t)string[error_offset])))
+    {
+        error = std::error_code();
+        threads = 1;
+        written = aybabtu::base64::decode(
+            string, size, output.data(), error, options.alphabet,
+            options.padding, aybabtu::whitespace::ignore, options.simd);
+        if (error)
+        {
+            fail("invalid input");
+        }
+    }
+    else if (error)
+    {
+        char detail[64];
+        std::snprintf(detail, sizeof(detail),
+                      "invalid character at offset %zu", error_offset);
+        fail("invalid input", detail);
+    }
+    return written;
+}
+}
+
+int main(int argc, char** argv)
+{
+    const options options = parse(argc, argv);
+
+    aybabtu::base64::set_threads(options.threads);
+    const aybabtu::simd simd = aybabtu::base64::selected_simd(options.simd);
+
+    input_data input(options.input);
+
+    // Large enough for the output in either direction, including the final
+    // line break:
+    std::size_t capacity = (input.size() + 3) / 4 * 3;
+    if (!options.decode && options.wrap == 0)
+    {
+        capacity = aybabtu::base64::encode_size(input.size(), options.padding);
+    }
+    else if (!options.decode)
+    {
+        capacity = aybabtu::base64::encode_size(input.size(), options.padding,
+                                                options.wrap,
+                                                aybabtu::line_break::lf) +
+                   1;
+    }
+    output_data output(options.output, capacity, input);
+
+    std::size_t threads = 1;
+    const auto start = std::chrono::steady_clock::now();
+    const std::size_t written = options.decode
+                                    ? decode(options, input, output, threads)
+                                    : encode(options, input, output, threads);
+    const auto stop = std::chrono::steady_clock::now();
+
+    output.commit(written);
+
+    if (options.verbose)
+    {
+        const double seconds =
+            std::chrono::duration<double>(stop - start).count();
+        std::fprintf(stderr,
+                     "aybabtu: %s %zu bytes to %zu bytes in %.6f s, %.2f GB/s "
+                     "(%s, %zu thread%s)\n",
+                     options.decode ? "decoded" : "encoded", input.size(),
+                     written, seconds,
+                     seconds > 0 ? input.size() / seconds / 1e9 : 0.0,
+                     simd_names[static_cast<std::size_t>(simd)],
+                     threads, threads == 1 ? "" : "s");
+    }
+    return 0;
+}
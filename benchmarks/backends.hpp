@@ -0,0 +1,40 @@
+// Copyright (c) Steinwurf ApS 2016.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <vector>
+
+#include <aybabtu/base64.hpp>
+
+/// A simd codec and the name it is reported under
+struct backend
+{
+    aybabtu::simd simd;
+    const char* name;
+};
+
+/// @return the simd codecs that can be requested on this machine
+inline std::vector<backend> supported_backends()
+{
+    const backend backends[] = {{aybabtu::simd::auto_, "auto"},
+                                {aybabtu::simd::none, "none"},
+                                {aybabtu::simd::ssse3, "ssse3"},
+                                {aybabtu::simd::avx2, "avx2"},
+                                {aybabtu::simd::neon, "neon"},
+                                {aybabtu::simd::avx512_vbmi, "avx512_vbmi"},
+                                {aybabtu::simd::avx512_bw, "avx512_bw"},
+                                {aybabtu::simd::avx512_vl, "avx512_vl"}};
+
+    std::vector<backend> result;
+    for (const auto& backend : backends)
+    {
+        if (aybabtu::base64::is_supported(backend.simd))
+        {
+            result.push_back(backend);
+        }
+    }
+    return result;
+}
@@ -0,0 +1,252 @@
+// Copyright (c) Steinwurf ApS 2016.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <aybabtu/base64.hpp>
+
+#include "backends.hpp"
+
+// Times every call of encode and decode on token-sized inputs and prints the
+// latency percentiles, which the averages of the throughput benchmark hide.
+//
+// The token sizes are sizes of the encoded string: 22 and 43 characters are
+// unpadded base64url encodings of 16 and 32 bytes, as used in URLs and JWTs,
+// and 24, 44, 64 and 88 characters are padded encodings of 16, 32, 48 and 64
+// bytes. Each is timed through the allocating std::string overloads and
+// through the raw-pointer overloads into a preallocated buffer.
+//
+// The "timer" row is the cost of reading the clock twice, which is included
+// in every other row. The "dispatch" rows encode and decode an empty input,
+// which is the cost of selecting the codec and the calls alone.
+
+namespace
+{
+const char* const usage =
+    "Usage: aybabtu_latency [--samples N]\n"
+    "\n"
+    "Print the p50, p90, p99 and p99.9 latency of encode and decode on\n"
+    "token-sized inputs for every simd codec the CPU supports.\n"
+    "\n"
+    "  -n, --samples N  the timed calls per row, by default 100000\n"
+    "  -h, --help       print this help\n";
+
+using clock_type = std::chrono::steady_clock;
+
+// The number of distinct tokens the calls cycle through, so the branch
+// predictors cannot learn a single input.
+const std::size_t tokens = 256;
+
+// The sizes of the tokens in bytes, encoded in 22, 24, 43, 44, 64 and 88
+// characters.
+const std::size_t token_sizes[] = {16, 16, 32, 32, 48, 64};
+const aybabtu::padding token_paddings[] = {
+    aybabtu::padding::disabled, aybabtu::padding::enabled,
+    aybabtu::padding::disabled, aybabtu::padding::enabled,
+    aybabtu::padding::enabled,  aybabtu::padding::enabled};
+
+// The binary tokens and their encodings for one token size.
+struct token_set
+{
+    token_set(std::size_t size, aybabtu::padding padding) :
+        padding(padding),
+        alphabet(padding == aybabtu::padding::enabled
+                     ? aybabtu::alphabet::standard
+                     : aybabtu::alphabet::url),
+        size(size)
+    {
+        for (std::size_t i = 0; i < tokens; ++i)
+        {
+            std::vector<uint8_t> token(size);
+            std::generate(token.begin(), token.end(), rand);
+            encoded.push_back(aybabtu::base64::encode(
+                token.data(), token.size(), alphabet, padding));
+            data.push_back(std::move(token));
+        }
+    }
+
+    aybabtu::padding padding;
+    aybabtu::alphabet alphabet;
+    std::size_t size;
+    std::vector<std::vector<uint8_t>> data;
+    std::vector<std::string> encoded;
+};
+
+// Time every call of function and print the percentiles of the latencies.
+template <class Function>
+void measure(const char* simd, const char* operation, const char* overload,
+             std::size_t characters, std::size_t samples, Function function)
+{
+    // Warm up the caches, the branch predictors and the allocator
+    for (std::size_t i = 0; i < samples / 10; ++i)
+    {
+        function(i % tokens);
+    }
+
+    std::vector<int64_t> latencies(samples);
+    for (std::size_t i = 0; i < samples; ++i)
+    {
+        const auto start = clock_type::now();
+        function(i % tokens);
+        const auto stop = clock_type::now();
+        latencies[i] =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start)
+                .count();
+    }
+    std::sort(latencies.begin(), latencies.end());
+
+    auto percentile = [&latencies](double p)
+    {
+        const auto rank = static_cast<std::size_t>(
+            std::ceil(p / 100.0 * static_cast<double>(latencies.size())));
+        return (long long)latencies[std::max<std::size_t>(rank, 1) - 1];
+    };
+
+    std::printf("%-12s %-9s %-8s %5zu %8lld %8lld %8lld %8lld %8lld\n", simd,
+                operation, overload, characters, percentile(50),
+                percentile(90), percentile(99), percentile(99.9),
+                (long long)latencies.back());
+}
+
+void measure_tokens(const backend& backend, const token_set& set,
+                    std::size_t samples)
+{
+    const auto simd = backend.simd;
+    const std::size_t characters = set.encoded.front().size();
+    std::vector<char> encoded(characters);
+    std::vector<uint8_t> decoded(set.size);
+    std::error_code error;
+
+    measure(backend.name, "encode", "string", characters, samples,
+            [&](std::size_t i)
+            {
+                auto string = aybabtu::base64::encode(
+                    set.data[i].data(), set.size, set.alphabet, set.padding,
+                    simd);
+                volatile char sink = string.back();
+                (void)sink;
+            });
+    measure(backend.name, "encode", "pointer", characters, samples,
+            [&](std::size_t i)
+            {
+                volatile std::size_t written = aybabtu::base64::encode(
+                    set.data[i].data(), set.size, encoded.data(),
+                    set.alphabet, set.padding, simd);
+                (void)written;
+            });
+    measure(backend.name, "decode", "string", characters, samples,
+            [&](std::size_t i)
+            {
+                std::vector<uint8_t> data(aybabtu::base64::decode_size(
+                    set.encoded[i], set.padding));
+                aybabtu::base64::decode(set.encoded[i], data.data(), error,
+                                        set.alphabet, set.padding, simd);
+                volatile uint8_t sink = data.back();
+                (void)sink;
+            });
+    measure(backend.name, "decode", "pointer", characters, samples,
+            [&](std::size_t i)
+            {
+                volatile std::size_t written = aybabtu::base64::decode(
+                    set.encoded[i].data(), characters, decoded.data(), error,
+                    set.alphabet, set.padding, simd);
+                (void)written;
+            });
+
+    if (error)
+    {
+        std::fprintf(stderr, "aybabtu_latency: decode failed\n");
+        std::exit(1);
+    }
+}
+
+void measure_dispatch(const backend& backend, std::size_t samples)
+{
+    const auto simd = backend.simd;
+    char encoded[4];
+    uint8_t decoded[3];
+    std::error_code error;
+
+    measure(backend.name, "encode", "dispatch", 0, samples,
+            [&](std::size_t)
+            {
+                volatile std::size_t written = aybabtu::base64::encode(
+                    decoded, 0, encoded, aybabtu::alphabet::standard,
+                    aybabtu::padding::enabled, simd);
+                (void)written;
+            });
+    measure(backend.name, "decode", "dispatch", 0, samples,
+            [&](std::size_t)
+            {
+                volatile std::size_t written = aybabtu::base64::decode(
+                    encoded, 0, decoded, error, aybabtu::alphabet::standard,
+                    aybabtu::padding::enabled, simd);
+                (void)written;
+            });
+}
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t samples = 100000;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if ((std::strcmp(argv[i], "-n") == 0 ||
+             std::strcmp(argv[i], "--samples") == 0) &&
+            i + 1 < argc)
+        {
+            samples = std::strtoul(argv[++i], nullptr, 10);
+        }
+        else if (std::strcmp(argv[i], "-h") == 0 ||
+                 std::strcmp(argv[i], "--help") == 0)
+        {
+            std::fputs(usage, stdout);
+            return 0;
+        }
+        else
+        {
+            std::fputs(usage, stderr);
+            return 1;
+        }
+    }
+    if (samples == 0)
+    {
+        std::fputs(usage, stderr);
+        return 1;
+    }
+
+    std::vector<token_set> sets;
+    for (std::size_t i = 0; i < sizeof(token_sizes) / sizeof(std::size_t);
+         ++i)
+    {
+        sets.emplace_back(token_sizes[i], token_paddings[i]);
+    }
+
+    std::printf("%-12s %-9s %-8s %5s %8s %8s %8s %8s %8s\n", "simd",
+                "operation", "overload", "chars", "p50 ns", "p90 ns",
+                "p99 ns", "p99.9 ns", "max ns");
+
+    measure("-", "timer", "-", 0, samples, [](std::size_t) {});
+
+    for (const auto& backend : supported_backends())
+    {
+        measure_dispatch(backend, samples);
+        for (const auto& set : sets)
+        {
+            measure_tokens(backend, set, samples);
+        }
+    }
+    return 0;
+}
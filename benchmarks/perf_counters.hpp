@@ -0,0 +1,188 @@
+// Copyright (c) Steinwurf ApS 2016.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/// Hardware performance counters of the calling thread, read through the
+/// Linux perf_event_open system call.
+///
+/// Every event is opened on its own, so an event that the CPU, the kernel or
+/// the perf_event_paranoid setting does not allow is left out without
+/// affecting the others. On other systems no event is available.
+class perf_counters
+{
+public:
+    /// The counted events
+    enum event
+    {
+        cycles,
+        instructions,
+        branch_misses,
+        l1d_misses,
+        llc_misses,
+        event_count
+    };
+
+    /// Open the events, or none of them if enabled is false
+    explicit perf_counters(bool enabled)
+    {
+        for (int i = 0; i < event_count; ++i)
+        {
+            m_fds[i] = -1;
+            m_values[i] = 0;
+        }
+        if (enabled)
+        {
+            open();
+        }
+    }
+
+    ~perf_counters()
+    {
+#if defined(__linux__)
+        for (int fd : m_fds)
+        {
+            if (fd >= 0)
+            {
+                close(fd);
+            }
+        }
+#endif
+    }
+
+    perf_counters(const perf_counters&) = delete;
+    perf_counters& operator=(const perf_counters&) = delete;
+
+    /// @return true if the event is counted
+    bool is_available(event event) const
+    {
+        return m_fds[event] >= 0;
+    }
+
+    /// @return why the first event that could not be opened was left out,
+    ///         or an empty string if every event is counted
+    const std::string& error() const
+    {
+        return m_error;
+    }
+
+    /// Reset the counters and start counting
+    void start()
+    {
+#if defined(__linux__)
+        for (int fd : m_fds)
+        {
+            if (fd >= 0)
+            {
+                ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+        }
+#endif
+    }
+
+    /// Stop counting and read the counters
+    void stop()
+    {
+#if defined(__linux__)
+        for (int fd : m_fds)
+        {
+            if (fd >= 0)
+            {
+                ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+            }
+        }
+        for (int i = 0; i < event_count; ++i)
+        {
+            m_values[i] = read_value(m_fds[i]);
+        }
+#endif
+    }
+
+    /// @return the count of the event between the last start and stop,
+    ///         scaled up if the kernel multiplexed the counter
+    double value(event event) const
+    {
+        return m_values[event];
+    }
+
+private:
+#if defined(__linux__)
+    void open()
+    {
+        const uint64_t l1d_read_miss =
+            PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+            (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+
+        m_fds[cycles] = open_event(PERF_TYPE_HARDWARE,
+                                   PERF_COUNT_HW_CPU_CYCLES);
+        m_fds[instructions] = open_event(PERF_TYPE_HARDWARE,
+                                         PERF_COUNT_HW_INSTRUCTIONS);
+        m_fds[branch_misses] = open_event(PERF_TYPE_HARDWARE,
+                                          PERF_COUNT_HW_BRANCH_MISSES);
+        m_fds[l1d_misses] = open_event(PERF_TYPE_HW_CACHE, l1d_read_miss);
+        m_fds[llc_misses] = open_event(PERF_TYPE_HARDWARE,
+                                       PERF_COUNT_HW_CACHE_MISSES);
+    }
+
+    int open_event(uint32_t type, uint64_t config)
+    {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.type = type;
+        attr.size = sizeof(attr);
+        attr.config = config;
+        attr.disabled = 1;
+        // Only count user space, which perf_event_paranoid 2 still allows
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format =
+            PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        const long fd = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+        if (fd < 0 && m_error.empty())
+        {
+            m_error = std::strerror(errno);
+        }
+        return static_cast<int>(fd);
+    }
+
+    static double read_value(int fd)
+    {
+        // The count, the time enabled and the time running
+        uint64_t values[3] = {0, 0, 0};
+        if (fd < 0 || read(fd, values, sizeof(values)) != sizeof(values) ||
+            values[2] == 0)
+        {
+            return 0;
+        }
+        return static_cast<double>(values[0]) *
+               static_cast<double>(values[1]) /
+               static_cast<double>(values[2]);
+    }
+#else
+    void open()
+    {
+        m_error = "perf_event_open is only available on Linux";
+    }
+#endif
+
+private:
+    int m_fds[event_count];
+    double m_values[event_count];
+    std::string m_error;
+};
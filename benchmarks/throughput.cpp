@@ -3,64 +3,328 @@
 //
 // Distributed under the "BSD License". See the accompanying LICENSE.rst file.
 
+#include <algorithm>
 #include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <system_error>
+#include <utility>
 #include <vector>
 
 #include <benchmark/benchmark.h>
 
 #include <aybabtu/base64.hpp>
 
-static void encode(benchmark::State& state, std::size_t size)
+#include "backends.hpp"
+#include "perf_counters.hpp"
+
+// Every benchmark is registered for each simd value the CPU supports, as
+// <operation>/<simd>/size:<bytes>/in:<offset>/out:<offset>. The sizes are the
+// sizes of the binary data, also for decode and validate, so the throughput
+// of the three operations can be compared directly. The offsets are the
+// input and output misalignment from a 64 byte boundary.
+//
+// The *_misaligned_in and *_misaligned_out variants sweep the offset of the
+// input or the output from 0 to 63 at a fixed size. The *_cold variants
+// rotate through copies of the buffers spanning twice the last level cache,
+// so every call starts with its input and output out of the cache. Run a
+// part of the matrix with --benchmark_filter, for example
+// --benchmark_filter='^decode/avx2/'.
+//
+// With --perf_counters every benchmark also reports the Linux hardware
+// counters of the benchmark thread: cycles per byte, instructions per cycle,
+// and the branch mispredictions, L1 data cache read misses and last level
+// cache misses per call. Counters the system does not permit are left out.
+
+// The largest size, 256 MiB, is reached in steps of 4 from 1 byte.
+static const int64_t max_size = 256 << 20;
+
+// The size used for the misalignment sweep.
+static const int64_t alignment_size = 4096;
+
+// Whether to read the hardware performance counters, set by --perf_counters.
+static bool use_perf_counters = false;
+
+// Copies of a buffer in one allocation, each starting offset bytes past a
+// 64 byte boundary.
+class arena
 {
-    state.counters["size"] = (double)size;
+public:
+    arena(std::size_t size, std::size_t copies, std::size_t offset) :
+        m_stride(stride(size)),
+        m_storage(m_stride * copies + 64), m_offset(offset)
+    {
+    }
 
-    std::vector<uint8_t> data_in(size);
-    std::generate(data_in.begin(), data_in.end(), rand);
+    // The bytes used by each copy of a buffer of the given size
+    static std::size_t stride(std::size_t size)
+    {
+        return (size + 63) / 64 * 64 + 64;
+    }
+
+    uint8_t* data(std::size_t copy)
+    {
+        const std::size_t misalignment =
+            reinterpret_cast<uintptr_t>(m_storage.data()) % 64;
+        return m_storage.data() + (64 - misalignment) % 64 +
+               copy * m_stride + m_offset;
+    }
+
+private:
+    std::size_t m_stride;
+    std::vector<uint8_t> m_storage;
+    std::size_t m_offset;
+};
 
-    std::vector<char> data_out(aybabtu::base64::encode_size(size));
-    aybabtu::base64::encode(data_in.data(), data_in.size(), data_out.data());
+// Fill with xorshift output, which is much faster than rand for the largest
+// sizes.
+static void fill_random(uint8_t* data, std::size_t size)
+{
+    uint64_t state = 0x9E3779B97F4A7C15ULL ^ size;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        data[i] = static_cast<uint8_t>(state);
+    }
+}
 
+// The number of copies of a working set, in bytes of arena memory, needed to
+// span twice the last level cache.
+static std::size_t cold_copies(std::size_t working_set)
+{
+    std::size_t cache = 32 << 20;
+    const auto& caches = benchmark::CPUInfo::Get().caches;
+    if (!caches.empty())
+    {
+        cache = 0;
+        for (const auto& info : caches)
+        {
+            cache = std::max(cache, static_cast<std::size_t>(info.size));
+        }
+    }
+    return std::max<std::size_t>(1, 2 * cache / std::max<std::size_t>(
+                                                    working_set, 1));
+}
+
+// The binary data, its encoding and the output, in as many copies as the
+// benchmark uses.
+struct workspace
+{
+    workspace(benchmark::State& state, bool cold) :
+        size(static_cast<std::size_t>(state.range(0))),
+        encoded_size(aybabtu::base64::encode_size(size)),
+        copies(cold ? cold_copies(arena::stride(size) +
+                                  2 * arena::stride(encoded_size))
+                    : 1),
+        data(size, copies, (std::size_t)state.range(1)),
+        encoded(encoded_size, copies, (std::size_t)state.range(1)),
+        out(encoded_size, copies, (std::size_t)state.range(2))
+    {
+        for (std::size_t i = 0; i < copies; ++i)
+        {
+            fill_random(data.data(i), size);
+            aybabtu::base64::encode(data.data(i), size,
+                                    (char*)encoded.data(i));
+        }
+    }
+
+    std::size_t size;
+    std::size_t encoded_size;
+    std::size_t copies;
+    arena data;
+    arena encoded;
+    arena out;
+};
+
+static void finish(benchmark::State& state, const workspace& workspace,
+                   const perf_counters& counters)
+{
+    state.counters["size"] = (double)workspace.size;
+    state.SetBytesProcessed(workspace.size * state.iterations());
+
+    const double bytes = (double)workspace.size * (double)state.iterations();
+    const double cycles = counters.value(perf_counters::cycles);
+    if (counters.is_available(perf_counters::cycles) && cycles > 0)
+    {
+        state.counters["cycles_per_byte"] = cycles / bytes;
+
+        if (counters.is_available(perf_counters::instructions))
+        {
+            state.counters["ipc"] =
+                counters.value(perf_counters::instructions) / cycles;
+        }
+    }
+
+    const std::pair<perf_counters::event, const char*> misses[] = {
+        {perf_counters::branch_misses, "branch_misses"},
+        {perf_counters::l1d_misses, "l1d_misses"},
+        {perf_counters::llc_misses, "llc_misses"}};
+    for (const auto& miss : misses)
+    {
+        if (counters.is_available(miss.first))
+        {
+            state.counters[miss.second] =
+                benchmark::Counter(counters.value(miss.first),
+                                   benchmark::Counter::kAvgIterations);
+        }
+    }
+}
+
+static void encode(benchmark::State& state, aybabtu::simd simd, bool cold)
+{
+    workspace w(state, cold);
+
+    perf_counters counters(use_perf_counters);
+
+    std::size_t i = 0;
+    counters.start();
     for (auto _ : state)
     {
-        aybabtu::base64::encode(data_in.data(), data_in.size(),
-                                data_out.data());
+        benchmark::DoNotOptimize(aybabtu::base64::encode(
+            w.data.data(i), w.size, (char*)w.out.data(i), simd));
+        i = i + 1 == w.copies ? 0 : i + 1;
     }
+    counters.stop();
 
-    state.SetBytesProcessed(size * state.iterations());
+    finish(state, w, counters);
 }
 
-static void decode(benchmark::State& state, std::size_t size)
+static void decode(benchmark::State& state, aybabtu::simd simd, bool cold)
 {
-    state.counters["size"] = (double)size;
+    workspace w(state, cold);
+    std::error_code error;
+
+    perf_counters counters(use_perf_counters);
 
-    std::vector<uint8_t> data_in(size);
-    std::generate(data_in.begin(), data_in.end(), rand);
+    std::size_t i = 0;
+    counters.start();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(
+            aybabtu::base64::decode((const char*)w.encoded.data(i),
+                                    w.encoded_size, w.out.data(i), error,
+                                    simd));
+        i = i + 1 == w.copies ? 0 : i + 1;
+    }
+    counters.stop();
 
-    std::vector<char> encoded(aybabtu::base64::encode_size(size));
-    aybabtu::base64::encode(data_in.data(), data_in.size(), encoded.data());
+    if (error)
+    {
+        state.SkipWithError("decode failed");
+    }
+    finish(state, w, counters);
+}
 
-    std::vector<uint8_t> data_out(size);
+static void validate(benchmark::State& state, aybabtu::simd simd, bool cold)
+{
+    workspace w(state, cold);
     std::error_code error;
+
+    perf_counters counters(use_perf_counters);
+
+    std::size_t i = 0;
+    counters.start();
     for (auto _ : state)
     {
-        benchmark::DoNotOptimize(aybabtu::base64::decode(
-            encoded.data(), encoded.size(), data_out.data(), error));
+        aybabtu::base64::validate((const char*)w.encoded.data(i),
+                                  w.encoded_size, error,
+                                  aybabtu::alphabet::standard,
+                                  aybabtu::padding::enabled, simd);
+        benchmark::DoNotOptimize(error);
+        i = i + 1 == w.copies ? 0 : i + 1;
+    }
+    counters.stop();
+
+    if (error)
+    {
+        state.SkipWithError("validate failed");
     }
+    finish(state, w, counters);
+}
+
+using operation = void (*)(benchmark::State&, aybabtu::simd, bool);
+
+static benchmark::internal::Benchmark*
+register_benchmark(const std::string& name, operation function,
+                   const backend& backend, bool cold)
+{
+    auto simd = backend.simd;
+    auto b = benchmark::RegisterBenchmark(
+        (name + "/" + backend.name).c_str(),
+        [=](benchmark::State& state) { function(state, simd, cold); });
 
-    state.SetBytesProcessed(size * state.iterations());
+    b->ArgNames({"size", "in", "out"});
+    // The threaded codecs do their work off the benchmark thread
+    b->UseRealTime();
+    return b;
 }
 
-static void BenchmarkArguments(benchmark::internal::Benchmark* b)
+static void register_operation(const std::string& name, operation function)
 {
-    b->Unit(benchmark::kMillisecond);
-    b->Repetitions(5);
+    for (const auto& backend : supported_backends())
+    {
+        auto warm = register_benchmark(name, function, backend, false);
+        auto cold = register_benchmark(name + "_cold", function, backend, true);
+        for (int64_t size = 1; size <= max_size; size *= 4)
+        {
+            warm->Args({size, 0, 0});
+            cold->Args({size, 0, 0});
+        }
+
+        auto in = register_benchmark(name + "_misaligned_in", function,
+                                     backend, false);
+        auto out = register_benchmark(name + "_misaligned_out", function,
+                                      backend, false);
+        for (int64_t offset = 0; offset < 64; ++offset)
+        {
+            in->Args({alignment_size, offset, 0});
+            out->Args({alignment_size, 0, offset});
+        }
+    }
 }
 
-BENCHMARK_CAPTURE(encode, 100, 100)->Apply(BenchmarkArguments);
-BENCHMARK_CAPTURE(encode, 1000, 1000)->Apply(BenchmarkArguments);
-BENCHMARK_CAPTURE(encode, 10000, 10000)->Apply(BenchmarkArguments);
-BENCHMARK_CAPTURE(decode, 100, 100)->Apply(BenchmarkArguments);
-BENCHMARK_CAPTURE(decode, 1000, 1000)->Apply(BenchmarkArguments);
-BENCHMARK_CAPTURE(decode, 10000, 10000)->Apply(BenchmarkArguments);
+int main(int argc, char** argv)
+{
+    // Take our own flag out before the benchmark library sees the arguments
+    int count = 1;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--perf_counters") == 0)
+        {
+            use_perf_counters = true;
+        }
+        else
+        {
+            argv[count++] = argv[i];
+        }
+    }
+    argc = count;
+
+    if (use_perf_counters)
+    {
+        perf_counters probe(true);
+        if (!probe.error().empty())
+        {
+            std::fprintf(stderr,
+                         "Some perf counters are not available (%s), the "
+                         "benchmarks run without them.\n",
+                         probe.error().c_str());
+        }
+    }
 
-BENCHMARK_MAIN();
+    register_operation("encode", encode);
+    register_operation("decode", decode);
+    register_operation("validate", validate);
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,24 @@
+// Copyright (c) Steinwurf ApS 2016.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include "version.hpp"
+
+namespace aybabtu
+{
+inline namespace STEINWURF_AYBABTU_VERSION
+{
+/// The base64 alphabet
+enum class alphabet
+{
+    /// The standard alphabet from RFC 4648 section 4, using '+' and '/'
+    standard,
+    /// The URL and filename safe alphabet from RFC 4648 section 5, using '-'
+    /// and '_'
+    url
+};
+}
+}
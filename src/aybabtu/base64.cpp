@@ -4,81 +4,910 @@
 // Distributed under the "BSD License". See the accompanying LICENSE.rst file.
 
 #include "base64.hpp"
-#include "detail/base64_avx2.hpp"
-#include "detail/base64_basic.hpp"
-#include "detail/base64_neon.hpp"
-#include "detail/base64_ssse3.hpp"
+#include "detail/base64_kernels.hpp"
+#include "detail/tables.hpp"
+#include "detail/thread_pool.hpp"
 
 #include "version.hpp"
 
-#include <cpuid/cpuinfo.hpp>
-#include <platform/config.hpp>
-
+#include <atomic>
+#include <cassert>
 #include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
 
 namespace aybabtu
 {
 inline namespace STEINWURF_AYBABTU_VERSION
 {
-const static cpuid::cpuinfo cpuinfo{};
+// The threads used for large inputs, or nullptr when threading is disabled.
+// The mutex is held by the call that uses the pool.
+static std::mutex pool_mutex;
+static std::unique_ptr<detail::thread_pool> pool;
+static std::atomic<std::size_t> pool_threshold{4 * 1024 * 1024};
+
+// The input size from which the kernels with non-temporal stores are used.
+static std::atomic<std::size_t> streaming_threshold{64 * 1024 * 1024};
+
+// Whether an input of the given size is split across the threads of the
+// pool. Smaller inputs go straight to the kernels, without locking the pool.
+static bool is_threaded(std::size_t size)
+{
+    return size >= pool_threshold.load(std::memory_order_relaxed);
+}
+
+// Lock the pool for an input that is split across its threads. The returned
+// lock does not own the mutex if threading is disabled or another call is
+// using the pool.
+static std::unique_lock<std::mutex> lock_pool()
+{
+    std::unique_lock<std::mutex> lock(pool_mutex, std::try_to_lock);
+    if (lock && !pool)
+    {
+        lock.unlock();
+    }
+    return lock;
+}
+
+// Whether an input of the given size is encoded or decoded with the kernels
+// that use non-temporal stores.
+static bool is_streaming(std::size_t size)
+{
+    return size >= streaming_threshold.load(std::memory_order_relaxed);
+}
+
+// Split the input into a slice per thread, each holding a multiple of group
+// bytes, and run slice(index, offset, length) for every slice. The pool must
+// be locked.
+template <class Slice>
+static void run_slices(std::size_t size, std::size_t group, Slice slice)
+{
+    const std::size_t slices = pool->threads();
+    const std::size_t length =
+        ((size + slices - 1) / slices + group - 1) / group * group;
+
+    pool->run(slices,
+              [&](std::size_t index)
+              {
+                  std::size_t offset = index * length;
+                  offset = offset < size ? offset : size;
+                  std::size_t n = size - offset;
+                  slice(index, offset, n < length ? n : length);
+              });
+}
+
+// Encode on the thread pool if the input is large enough. Every slice but
+// the last holds whole 3-byte groups, so the output of the slices is
+// contiguous.
+template <class Encode>
+static std::size_t encode_threaded(const uint8_t* data, std::size_t size,
+                                   uint8_t* out, Encode encode)
+{
+    if (!is_threaded(size))
+    {
+        return encode(data, size, out);
+    }
+
+    auto lock = lock_pool();
+    if (!lock)
+    {
+        return encode(data, size, out);
+    }
+
+    std::vector<std::size_t> written(pool->threads());
+    run_slices(size, 3,
+               [&](std::size_t index, std::size_t offset, std::size_t length)
+               {
+                   written[index] =
+                       encode(data + offset, length, out + offset / 3 * 4);
+               });
+
+    std::size_t result = 0;
+    for (std::size_t n : written)
+    {
+        result += n;
+    }
+    return result;
+}
+
+// Decode on the thread pool if the input is large enough. Every slice but
+// the last holds whole 4-character groups, so the output of the slices is
+// contiguous. The first error, in string order, is reported, and like the
+// kernels the number of bytes decoded before the failing group is returned.
+template <class Decode>
+static std::size_t decode_threaded(const uint8_t* string, std::size_t size,
+                                   uint8_t* out, std::error_code& error,
+                                   Decode decode)
+{
+    if (!is_threaded(size))
+    {
+        return decode(string, size, out, error);
+    }
+
+    auto lock = lock_pool();
+    if (!lock)
+    {
+        return decode(string, size, out, error);
+    }
+
+    std::vector<std::size_t> written(pool->threads());
+    std::vector<std::error_code> errors(written.size());
+    run_slices(size, 4,
+               [&](std::size_t index, std::size_t offset, std::size_t length)
+               {
+                   written[index] = decode(string + offset, length,
+                                           out + offset / 4 * 3, errors[index]);
+               });
+
+    std::size_t result = 0;
+    for (std::size_t i = 0; i < written.size(); ++i)
+    {
+        result += written[i];
+        if (errors[i])
+        {
+            error = errors[i];
+            return result;
+        }
+    }
+    return result;
+}
+
+// The kernels do not pad, so the padding is added here.
+static std::size_t add_padding(char* out, std::size_t written,
+                               padding padding)
+{
+    if (padding == padding::enabled)
+    {
+        while (written % 4 != 0)
+        {
+            out[written++] = '=';
+        }
+    }
+    return written;
+}
+
+// The kernels do not accept padding, so up to two padding characters are
+// removed here. Any other '=' is rejected by the kernels.
+static std::size_t remove_padding(const char* string, std::size_t size,
+                                  padding padding, std::error_code& error)
+{
+    if (padding == padding::enabled)
+    {
+        if (size % 4 != 0)
+        {
+            error = std::make_error_code(std::errc::invalid_argument);
+            return 0;
+        }
+        if (size >= 1 && string[size - 1] == '=')
+        {
+            size--;
+            if (string[size - 1] == '=')
+            {
+                size--;
+            }
+        }
+    }
+    return size;
+}
+
+// Decode a string and locate the first invalid character on errors. The
+// kernels stop in the group holding it, so at most four characters are
+// checked here.
+template <class Decode>
+static std::size_t decode_located(const char* string, std::size_t size,
+                                  uint8_t* out, std::error_code& error,
+                                  std::size_t& error_offset, padding padding,
+                                  const uint8_t* table, Decode decode)
+{
+    std::size_t unpadded = remove_padding(string, size, padding, error);
+    if (!error && unpadded % 4 == 1)
+    {
+        error = std::make_error_code(std::errc::invalid_argument);
+    }
+    if (error)
+    {
+        error_offset = size;
+        return 0;
+    }
+
+    std::size_t written =
+        decode_threaded((const uint8_t*)string, unpadded, out, error, decode);
+    if (error)
+    {
+        error_offset = written / 3 * 4;
+        while (error_offset < unpadded &&
+               table[(uint8_t)string[error_offset]] < 254)
+        {
+            error_offset++;
+        }
+        assert(error_offset < unpadded);
+        return 0;
+    }
+    return written;
+}
+
+// Decode with the output overlapping the input. Every vector loop stores no
+// further ahead than the characters it has already loaded, and the SSSE3
+// tail loads up to 12 characters behind its position, so the output must
+// stay at least that far behind the input. The first 64 characters are
+// therefore decoded into a buffer, which puts the output of the rest 16
+// bytes behind its input. The threads are not used, since every slice would
+// overwrite the input of the slice before it.
+template <class Decode>
+static std::size_t decode_overlapping(char* string, std::size_t size,
+                                      std::error_code& error, padding padding,
+                                      Decode decode)
+{
+    assert(string != nullptr || size == 0);
+
+    // An empty string, e.g. the data of an empty vector, may be null:
+    if (size == 0)
+    {
+        return 0;
+    }
+
+    size = remove_padding(string, size, padding, error);
+    if (error)
+    {
+        return 0;
+    }
+
+    const uint8_t* src = (const uint8_t*)string;
+    uint8_t* out = (uint8_t*)string;
+
+    const std::size_t head = size < 64 ? size : 64;
+    uint8_t buffer[48];
+    std::size_t written = decode(src, head, buffer, error);
+    if (error)
+    {
+        return 0;
+    }
+
+    std::size_t rest = 0;
+    if (size > head)
+    {
+        rest = decode(src + head, size - head, out + written, error);
+        if (error)
+        {
+            return 0;
+        }
+    }
+    std::memcpy(out, buffer, written);
+    return written + rest;
+}
+
+// The data is encoded one block at a time into a buffer that stays in the L1
+// cache, and the lines are copied from there to the output with the line
+// breaks in between. This way the output is only written once.
+template <class Encode>
+static std::size_t encode_wrapped(const uint8_t* data, std::size_t size,
+                                  char* out, padding padding,
+                                  std::size_t line_length,
+                                  line_break line_break, Encode encode)
+{
+    assert(line_length > 0);
+
+    // A multiple of 3 bytes, so that only the last block ends a group:
+    const std::size_t block = 3072;
+
+    // The encoded block and up to two padding characters, with room for
+    // reading whole 16-byte chunks:
+    char buffer[block / 3 * 4 + 16];
+    std::size_t written = 0;
+    std::size_t column = 0;
+
+    while (size > 0)
+    {
+        std::size_t n = size < block ? size : block;
+        std::size_t chars = encode(data, n, (uint8_t*)buffer);
+        data += n;
+        size -= n;
+
+        if (size == 0)
+        {
+            chars = add_padding(buffer, chars, padding);
+        }
+
+        for (std::size_t i = 0; i < chars;)
+        {
+            if (column == line_length)
+            {
+                if (line_break == line_break::crlf)
+                {
+                    out[written++] = '\r';
+                }
+                out[written++] = '\n';
+                column = 0;
+            }
+
+            std::size_t m = line_length - column;
+            m = m < chars - i ? m : chars - i;
+            if (size >= 12)
+            {
+                // At least 16 more characters follow this block, so the line
+                // can be copied 16 bytes at a time. The bytes written past
+                // the line are overwritten later on:
+                for (std::size_t j = 0; j < m; j += 16)
+                {
+                    std::memcpy(out + written + j, buffer + i + j, 16);
+                }
+            }
+            else
+            {
+                std::memcpy(out + written, buffer + i, m);
+            }
+            written += m;
+            column += m;
+            i += m;
+        }
+    }
+    return written;
+}
+
+// Encode wrapped lines on the thread pool if the input is large enough. Every
+// slice but the last holds the data of whole lines that are also whole 3-byte
+// groups, so every slice starts a line at a known offset, and writes the line
+// break in front of it.
+template <class Encode>
+static std::size_t encode_wrapped_threaded(const uint8_t* data,
+                                           std::size_t size, char* out,
+                                           padding padding,
+                                           std::size_t line_length,
+                                           line_break line_break, Encode encode)
+{
+    if (!is_threaded(size))
+    {
+        return encode_wrapped(data, size, out, padding, line_length,
+                              line_break, encode);
+    }
+
+    auto lock = lock_pool();
+    if (!lock)
+    {
+        return encode_wrapped(data, size, out, padding, line_length,
+                              line_break, encode);
+    }
+
+    // The fewest whole lines that hold whole groups:
+    std::size_t lines = 1;
+    while (lines * line_length % 4 != 0)
+    {
+        lines++;
+    }
+    const std::size_t group = lines * line_length / 4 * 3;
+    const std::size_t breaks = line_break == line_break::crlf ? 2 : 1;
+
+    std::vector<std::size_t> written(pool->threads());
+    run_slices(size, group,
+               [&](std::size_t index, std::size_t offset, std::size_t length)
+               {
+                   if (length == 0)
+                   {
+                       return;
+                   }
+
+                   const std::size_t chars = offset / 3 * 4;
+                   char* start = out + chars + chars / line_length * breaks;
+                   if (offset > 0)
+                   {
+                       if (line_break == line_break::crlf)
+                       {
+                           start[-2] = '\r';
+                       }
+                       start[-1] = '\n';
+                       written[index] = breaks;
+                   }
+                   written[index] +=
+                       encode_wrapped(data + offset, length, start, padding,
+                                      line_length, line_break, encode);
+               });
+
+    std::size_t result = 0;
+    for (std::size_t n : written)
+    {
+        result += n;
+    }
+    return result;
+}
+
+// The whitespace is removed one block at a time into a buffer that stays in
+// the L1 cache, and the complete groups of the buffer are decoded by the
+// normal kernels. The last group is held back until the end, so that the
+// padding can be removed from it.
+template <class Decode>
+static std::size_t decode_ignoring_whitespace(
+    const detail::base64_kernels& kernels, const char* string,
+    std::size_t size, uint8_t* out, std::error_code& error, padding padding,
+    Decode decode)
+{
+    const std::size_t block = 4096;
+
+    // Up to 7 characters are carried over from the previous block:
+    uint8_t buffer[block + 8];
+    std::size_t buffered = 0;
+    std::size_t written = 0;
+
+    const uint8_t* src = (const uint8_t*)string;
+    while (size > 0)
+    {
+        std::size_t n = size < block ? size : block;
+        buffered += kernels.strip_whitespace(src, n, buffer + buffered);
+        src += n;
+        size -= n;
+
+        if (buffered > 8)
+        {
+            // Keep between 4 and 7 characters, which includes the last group:
+            std::size_t groups = (buffered - 4) / 4 * 4;
+            written += decode(buffer, groups, out + written, error);
+            if (error)
+            {
+                return 0;
+            }
+            buffered -= groups;
+            std::memmove(buffer, buffer + groups, buffered);
+        }
+    }
+
+    // Only complete groups were decoded, so the buffer holds as many
+    // characters modulo 4 as the string without whitespace:
+    buffered = remove_padding((const char*)buffer, buffered, padding, error);
+    if (error)
+    {
+        return 0;
+    }
+    written += decode(buffer, buffered, out + written, error);
+    if (error)
+    {
+        return 0;
+    }
+    return written;
+}
+
+// The values of a batch are encoded one by one with the kernels that were
+// selected for the batch.
+template <class Encode>
+static std::size_t encode_batch_values(const uint8_t* data,
+                                       const uint32_t* offsets,
+                                       std::size_t count, char* out,
+                                       uint32_t* out_offsets,
+                                       std::error_code& error, padding padding,
+                                       Encode encode)
+{
+    std::size_t written = 0;
+    out_offsets[0] = 0;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        // Encoding grows the data by 4/3, so a column that fits the 32-bit
+        // offsets can encode to one that does not:
+        const std::size_t size = offsets[i + 1] - offsets[i];
+        if (base64::encode_size(size, padding) > UINT32_MAX - written)
+        {
+            error = std::make_error_code(std::errc::value_too_large);
+            return 0;
+        }
+        written += encode(data + offsets[i], size, (uint8_t*)out + written);
+        written = add_padding(out, written, padding);
+        out_offsets[i + 1] = static_cast<uint32_t>(written);
+    }
+    return written;
+}
+
+template <class Decode>
+static std::size_t decode_batch_values(const char* column,
+                                       const uint32_t* offsets,
+                                       std::size_t count, uint8_t* out,
+                                       uint32_t* out_offsets,
+                                       std::error_code& error,
+                                       std::size_t& error_index,
+                                       padding padding, Decode decode)
+{
+    std::size_t written = 0;
+    out_offsets[0] = 0;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const char* string = column + offsets[i];
+        std::size_t size = remove_padding(
+            string, offsets[i + 1] - offsets[i], padding, error);
+        if (!error)
+        {
+            written +=
+                decode((const uint8_t*)string, size, out + written, error);
+        }
+        if (error)
+        {
+            error_index = i;
+            return 0;
+        }
+        // Decoding shrinks the data, so this fits the 32-bit offsets of the
+        // input column:
+        out_offsets[i + 1] = static_cast<uint32_t>(written);
+    }
+    return written;
+}
+
+void base64::set_threads(std::size_t threads)
+{
+    if (threads == 0)
+    {
+        threads = std::thread::hardware_concurrency();
+    }
+
+    std::lock_guard<std::mutex> lock(pool_mutex);
+    pool.reset(threads > 1 ? new detail::thread_pool(threads) : nullptr);
+}
+
+std::size_t base64::threads()
+{
+    std::lock_guard<std::mutex> lock(pool_mutex);
+    return pool ? pool->threads() : 1;
+}
+
+void base64::set_thread_threshold(std::size_t size)
+{
+    pool_threshold.store(size, std::memory_order_relaxed);
+}
+
+std::size_t base64::thread_threshold()
+{
+    return pool_threshold.load(std::memory_order_relaxed);
+}
+
+void base64::set_stream_threshold(std::size_t size)
+{
+    streaming_threshold.store(size, std::memory_order_relaxed);
+}
+
+std::size_t base64::stream_threshold()
+{
+    return streaming_threshold.load(std::memory_order_relaxed);
+}
+
+simd base64::selected_simd(simd simd)
+{
+    return detail::base64_kernels::select(simd).simd;
+}
+
+bool base64::is_supported(simd simd)
+{
+    return detail::base64_kernels::is_supported(simd);
+}
+
+std::size_t base64::encode(const uint8_t* data, std::size_t size, char* out,
+                           simd simd)
+{
+    return encode(data, size, out, alphabet::standard, padding::enabled, simd);
+}
+
+std::size_t base64::decode(const char* string, std::size_t size, uint8_t* out,
+                           std::error_code& error, simd simd) noexcept
+{
+    return decode(string, size, out, error, alphabet::standard,
+                  padding::enabled, simd);
+}
+
+std::size_t base64::encode(const uint8_t* data, std::size_t size, char* out,
+                           alphabet alphabet, padding padding, simd simd)
+{
+    const auto& kernels = detail::base64_kernels::select(simd);
+    const std::size_t index = static_cast<std::size_t>(alphabet);
+    std::size_t written = encode_threaded(
+        data, size, (uint8_t*)out,
+        is_streaming(size) ? kernels.encode_stream[index]
+                           : kernels.encode[index]);
+    return add_padding(out, written, padding);
+}
+
+std::size_t base64::decode(const char* string, std::size_t size, uint8_t* out,
+                           std::error_code& error, alphabet alphabet,
+                           padding padding, simd simd) noexcept
+{
+    std::size_t error_offset;
+    return decode(string, size, out, error, error_offset, alphabet, padding,
+                  simd);
+}
+
+std::size_t base64::decode(const char* string, std::size_t size, uint8_t* out,
+                           std::error_code& error, std::size_t& error_offset,
+                           alphabet alphabet, padding padding,
+                           simd simd) noexcept
+{
+    const auto& kernels = detail::base64_kernels::select(simd);
+    const std::size_t index = static_cast<std::size_t>(alphabet);
+    return decode_located(
+        string, size, out, error, error_offset, padding,
+        alphabet == alphabet::url ? detail::tables::decode_url
+                                  : detail::tables::decode,
+        is_streaming(size) ? kernels.decode_stream[index]
+                           : kernels.decode[index]);
+}
+
+std::size_t base64::encode(const uint8_t* data, std::size_t size, char* out,
+                           const custom_alphabet& alphabet, padding padding,
+                           simd simd)
+{
+    const auto& kernels = detail::base64_kernels::select(simd);
+    const uint8_t* table = alphabet.encode_table();
+    std::size_t written = encode_threaded(
+        data, size, (uint8_t*)out,
+        [&kernels, table](const uint8_t* src, std::size_t n, uint8_t* dst)
+        { return kernels.encode_custom(src, n, dst, table); });
+    return add_padding(out, written, padding);
+}
+
+std::size_t base64::decode(const char* string, std::size_t size, uint8_t* out,
+                           std::error_code& error,
+                           const custom_alphabet& alphabet, padding padding,
+                           simd simd) noexcept
+{
+    std::size_t error_offset;
+    return decode(string, size, out, error, error_offset, alphabet, padding,
+                  simd);
+}
+
+std::size_t base64::decode(const char* string, std::size_t size, uint8_t* out,
+                           std::error_code& error, std::size_t& error_offset,
+                           const custom_alphabet& alphabet, padding padding,
+                           simd simd) noexcept
+{
+    const auto& kernels = detail::base64_kernels::select(simd);
+    const uint8_t* table = alphabet.decode_table();
+    return decode_located(
+        string, size, out, error, error_offset, padding, table,
+        [&kernels, table](const uint8_t* src, std::size_t n, uint8_t* dst,
+                          std::error_code& e)
+        { return kernels.decode_custom(src, n, dst, table, e); });
+}
 
 std::size_t base64::encode(const uint8_t* data, std::size_t size, char* out,
+                           alphabet alphabet, padding padding,
+                           std::size_t line_length, line_break line_break,
                            simd simd)
 {
-#if defined(PLATFORM_X86)
-    if ((simd == simd::auto_ && detail::base64_avx2::is_compiled() &&
-         cpuinfo.has_avx2()) ||
-        simd == simd::avx2)
+    if (line_length == 0)
     {
-        return detail::base64_avx2::encode(data, size, (uint8_t*)out);
+        return encode(data, size, out, alphabet, padding, simd);
     }
-    if ((simd == simd::auto_ && detail::base64_ssse3::is_compiled() &&
-         cpuinfo.has_ssse3()) ||
-        simd == simd::ssse3)
+
+    const auto& kernels = detail::base64_kernels::select(simd);
+    const auto encode = kernels.encode[static_cast<std::size_t>(alphabet)];
+    return encode_wrapped_threaded(data, size, out, padding, line_length,
+                                   line_break, encode);
+}
+
+std::size_t base64::encode(const uint8_t* data, std::size_t size, char* out,
+                           const custom_alphabet& alphabet, padding padding,
+                           std::size_t line_length, line_break line_break,
+                           simd simd)
+{
+    if (line_length == 0)
     {
-        return detail::base64_ssse3::encode(data, size, (uint8_t*)out);
+        return encode(data, size, out, alphabet, padding, simd);
     }
-#elif defined(PLATFORM_ARM)
-    if ((simd == simd::auto_ && detail::base64_neon::is_compiled() &&
-         cpuinfo.has_neon()) ||
-        simd == simd::neon)
+
+    const auto& kernels = detail::base64_kernels::select(simd);
+    const uint8_t* table = alphabet.encode_table();
+    return encode_wrapped_threaded(
+        data, size, out, padding, line_length, line_break,
+        [&kernels, table](const uint8_t* src, std::size_t n, uint8_t* dst)
+        { return kernels.encode_custom(src, n, dst, table); });
+}
+
+std::size_t base64::decode(const char* string, std::size_t size, uint8_t* out,
+                           std::error_code& error, alphabet alphabet,
+                           padding padding, whitespace whitespace,
+                           simd simd) noexcept
+{
+    if (whitespace == whitespace::reject)
     {
-        return detail::base64_neon::encode(data, size, (uint8_t*)out);
+        return decode(string, size, out, error, alphabet, padding, simd);
     }
-#endif
-    return detail::base64_basic::encode(data, size, (uint8_t*)out);
+
+    const auto& kernels = detail::base64_kernels::select(simd);
+    const auto decode = kernels.decode[static_cast<std::size_t>(alphabet)];
+    return decode_ignoring_whitespace(kernels, string, size, out, error,
+                                      padding, decode);
 }
 
 std::size_t base64::decode(const char* string, std::size_t size, uint8_t* out,
-                           std::error_code& error, simd simd) noexcept
+                           std::error_code& error,
+                           const custom_alphabet& alphabet, padding padding,
+                           whitespace whitespace, simd simd) noexcept
+{
+    if (whitespace == whitespace::reject)
+    {
+        return decode(string, size, out, error, alphabet, padding, simd);
+    }
+
+    const auto& kernels = detail::base64_kernels::select(simd);
+    const uint8_t* table = alphabet.decode_table();
+    return decode_ignoring_whitespace(
+        kernels, string, size, out, error, padding,
+        [&kernels, table](const uint8_t* src, std::size_t n, uint8_t* dst,
+                          std::error_code& e)
+        { return kernels.decode_custom(src, n, dst, table, e); });
+}
+
+void base64::validate(const char* string, std::size_t size,
+                      std::error_code& error, alphabet alphabet,
+                      padding padding, simd simd) noexcept
 {
-#if defined(PLATFORM_X86)
-    if ((simd == simd::auto_ && detail::base64_avx2::is_compiled() &&
-         cpuinfo.has_avx2()) ||
-        simd == simd::avx2)
+    size = remove_padding(string, size, padding, error);
+    if (error)
     {
-        return detail::base64_avx2::decode((const uint8_t*)string, size, out,
-                                           error);
+        return;
     }
 
-    if ((simd == simd::auto_ && detail::base64_ssse3::is_compiled() &&
-         cpuinfo.has_ssse3()) ||
-        simd == simd::ssse3)
+    const auto& kernels = detail::base64_kernels::select(simd);
+    if (!kernels.validate[static_cast<std::size_t>(alphabet)](
+            (const uint8_t*)string, size))
+    {
+        error = std::make_error_code(std::errc::invalid_argument);
+    }
+}
+
+void base64::validate(const char* string, std::size_t size,
+                      std::error_code& error, const custom_alphabet& alphabet,
+                      padding padding, simd simd) noexcept
+{
+    size = remove_padding(string, size, padding, error);
+    if (error)
     {
-        return detail::base64_ssse3::decode((const uint8_t*)string, size, out,
-                                            error);
+        return;
     }
-#elif defined(PLATFORM_ARM)
-    if ((simd == simd::auto_ && detail::base64_neon::is_compiled() &&
-         cpuinfo.has_neon()) ||
-        simd == simd::neon)
+
+    const auto& kernels = detail::base64_kernels::select(simd);
+    if (!kernels.validate_custom((const uint8_t*)string, size,
+                                 alphabet.decode_table()))
     {
-        return detail::base64_neon::decode((const uint8_t*)string, size, out,
-                                           error);
+        error = std::make_error_code(std::errc::invalid_argument);
     }
-#endif
-    return detail::base64_basic::decode((const uint8_t*)string, size, out,
-                                        error);
+}
+
+std::size_t base64::decode_inplace(char* string, std::size_t size,
+                                   std::error_code& error, alphabet alphabet,
+                                   padding padding, simd simd) noexcept
+{
+    const auto& kernels = detail::base64_kernels::select(simd);
+    return decode_overlapping(
+        string, size, error, padding,
+        kernels.decode[static_cast<std::size_t>(alphabet)]);
+}
+
+std::size_t base64::decode_inplace(char* string, std::size_t size,
+                                   std::error_code& error,
+                                   const custom_alphabet& alphabet,
+                                   padding padding, simd simd) noexcept
+{
+    const auto& kernels = detail::base64_kernels::select(simd);
+    const uint8_t* table = alphabet.decode_table();
+    return decode_overlapping(
+        string, size, error, padding,
+        [&kernels, table](const uint8_t* src, std::size_t n, uint8_t* dst,
+                          std::error_code& e)
+        { return kernels.decode_custom(src, n, dst, table, e); });
+}
+
+// The encoded string overwrites the data from the back, so a buffer that is
+// too small would be overrun before anything could be detected.
+static void check_capacity(std::size_t size, std::size_t capacity,
+                           padding padding)
+{
+    if (capacity < base64::encode_size(size, padding))
+    {
+        throw std::invalid_argument(
+            "aybabtu::base64::encode_inplace: the capacity must hold the "
+            "encoded string");
+    }
+}
+
+std::size_t base64::encode_inplace(uint8_t* buffer, std::size_t size,
+                                   std::size_t capacity, alphabet alphabet,
+                                   padding padding, simd simd)
+{
+    assert(buffer != nullptr || size == 0);
+    check_capacity(size, capacity, padding);
+
+    const auto& kernels = detail::base64_kernels::select(simd);
+    std::size_t written =
+        kernels.encode_inplace[static_cast<std::size_t>(alphabet)](buffer,
+                                                                   size);
+    return add_padding((char*)buffer, written, padding);
+}
+
+std::size_t base64::encode_inplace(uint8_t* buffer, std::size_t size,
+                                   std::size_t capacity,
+                                   const custom_alphabet& alphabet,
+                                   padding padding, simd simd)
+{
+    assert(buffer != nullptr || size == 0);
+    check_capacity(size, capacity, padding);
+
+    const auto& kernels = detail::base64_kernels::select(simd);
+    std::size_t written =
+        kernels.encode_inplace_custom(buffer, size, alphabet.encode_table());
+    return add_padding((char*)buffer, written, padding);
+}
+
+std::size_t base64::encode_batch(const uint8_t* data, const uint32_t* offsets,
+                                 std::size_t count, char* out,
+                                 uint32_t* out_offsets, std::error_code& error,
+                                 alphabet alphabet, padding padding, simd simd)
+{
+    const auto& kernels = detail::base64_kernels::select(simd);
+    return encode_batch_values(
+        data, offsets, count, out, out_offsets, error, padding,
+        kernels.encode[static_cast<std::size_t>(alphabet)]);
+}
+
+std::size_t base64::encode_batch(const uint8_t* data, const uint32_t* offsets,
+                                 std::size_t count, char* out,
+                                 uint32_t* out_offsets, std::error_code& error,
+                                 const custom_alphabet& alphabet,
+                                 padding padding, simd simd)
+{
+    const auto& kernels = detail::base64_kernels::select(simd);
+    const uint8_t* table = alphabet.encode_table();
+    return encode_batch_values(
+        data, offsets, count, out, out_offsets, error, padding,
+        [&kernels, table](const uint8_t* src, std::size_t n, uint8_t* dst)
+        { return kernels.encode_custom(src, n, dst, table); });
+}
+
+std::size_t base64::decode_batch(const char* column, const uint32_t* offsets,
+                                 std::size_t count, uint8_t* out,
+                                 uint32_t* out_offsets, std::error_code& error,
+                                 alphabet alphabet, padding padding,
+                                 simd simd) noexcept
+{
+    std::size_t error_index;
+    return decode_batch(column, offsets, count, out, out_offsets, error,
+                        error_index, alphabet, padding, simd);
+}
+
+std::size_t base64::decode_batch(const char* column, const uint32_t* offsets,
+                                 std::size_t count, uint8_t* out,
+                                 uint32_t* out_offsets, std::error_code& error,
+                                 std::size_t& error_index, alphabet alphabet,
+                                 padding padding, simd simd) noexcept
+{
+    const auto& kernels = detail::base64_kernels::select(simd);
+    return decode_batch_values(
+        column, offsets, count, out, out_offsets, error, error_index, padding,
+        kernels.decode[static_cast<std::size_t>(alphabet)]);
+}
+
+std::size_t base64::decode_batch(const char* column, const uint32_t* offsets,
+                                 std::size_t count, uint8_t* out,
+                                 uint32_t* out_offsets, std::error_code& error,
+                                 const custom_alphabet& alphabet,
+                                 padding padding, simd simd) noexcept
+{
+    std::size_t error_index;
+    return decode_batch(column, offsets, count, out, out_offsets, error,
+                        error_index, alphabet, padding, simd);
+}
+
+std::size_t base64::decode_batch(const char* column, const uint32_t* offsets,
+                                 std::size_t count, uint8_t* out,
+                                 uint32_t* out_offsets, std::error_code& error,
+                                 std::size_t& error_index,
+                                 const custom_alphabet& alphabet,
+                                 padding padding, simd simd) noexcept
+{
+    const auto& kernels = detail::base64_kernels::select(simd);
+    const uint8_t* table = alphabet.decode_table();
+    return decode_batch_values(
+        column, offsets, count, out, out_offsets, error, error_index, padding,
+        [&kernels, table](const uint8_t* src, std::size_t n, uint8_t* dst,
+                          std::error_code& e)
+        { return kernels.decode_custom(src, n, dst, table, e); });
 }
 }
 }
@@ -9,8 +9,14 @@
 #include <cstdint>
 #include <string>
 #include <system_error>
+#include <vector>
 
+#include "alphabet.hpp"
+#include "custom_alphabet.hpp"
+#include "line_break.hpp"
+#include "padding.hpp"
 #include "simd.hpp"
+#include "whitespace.hpp"
 
 #include "version.hpp"
 
@@ -20,6 +26,62 @@ inline namespace STEINWURF_AYBABTU_VERSION
 {
 struct base64
 {
+    /// Set the number of threads that encode and decode large inputs. The
+    /// input is split into one slice per thread, at group boundaries, and
+    /// every slice is processed by the selected simd codec. The output is
+    /// identical to that of a single thread.
+    ///
+    /// The threads are started here and kept until the next call. Only one
+    /// call at a time uses the threads; calls made meanwhile from other
+    /// threads run on their calling thread. Wrapped encoding splits the
+    /// input at whole lines. Decoding that ignores whitespace always runs on
+    /// the calling thread.
+    ///
+    /// @param threads the number of threads including the calling thread,
+    ///        by default 1, which disables threading. 0 uses
+    ///        std::thread::hardware_concurrency().
+    static void set_threads(std::size_t threads);
+
+    /// @return the number of threads that encode and decode large inputs
+    static std::size_t threads();
+
+    /// Set the input size from which encode and decode use threads.
+    /// @param size the size of the data to encode or of the string to
+    ///        decode in bytes, by default 4 MiB
+    static void set_thread_threshold(std::size_t size);
+
+    /// @return the input size from which encode and decode use threads
+    static std::size_t thread_threshold();
+
+    /// Set the input size from which encode and decode write their output
+    /// with non-temporal stores. These stores bypass the caches, which
+    /// keeps the output of inputs much larger than the last-level cache
+    /// from evicting the rest of the working set, and saves reading the
+    /// output into the cache before it is written. Only the SSSE3, AVX2 and
+    /// AVX-512 codecs have them, and only for the built-in alphabets.
+    ///
+    /// @param size the size of the data to encode or of the string to
+    ///        decode in bytes, by default 64 MiB. 0 always uses non-temporal
+    ///        stores and std::numeric_limits<std::size_t>::max() never does.
+    static void set_stream_threshold(std::size_t size);
+
+    /// @return the input size from which encode and decode write their
+    ///         output with non-temporal stores
+    static std::size_t stream_threshold();
+
+    /// The acceleration that encode and decode use for a requested one.
+    /// @param simd the requested simd instruction set
+    /// @return the simd instruction set that is used, never simd::auto_
+    static simd selected_simd(simd simd = simd::auto_);
+
+    /// Whether an acceleration can be requested on this machine, that is
+    /// whether its codec is compiled in and the CPU has the instructions it
+    /// uses.
+    /// @param simd the simd instruction set
+    /// @return whether the instruction set is supported, always true for
+    ///         simd::auto_ and simd::none
+    static bool is_supported(simd simd);
+
     /// The size of the encoded data.
     /// @param size size of the data to be encoded
     /// @return the size of the encoded string
@@ -28,6 +90,35 @@ struct base64
         return ((4 * size / 3) + 3) & ~3;
     }
 
+    /// The size of the encoded data.
+    /// @param size size of the data to be encoded
+    /// @param padding whether the encoded string is padded with '='
+    /// @return the size of the encoded string
+    constexpr static std::size_t encode_size(std::size_t size, padding padding)
+    {
+        return padding == padding::enabled ? encode_size(size)
+                                           : (4 * size + 2) / 3;
+    }
+
+    /// The size of the encoded data, when it is wrapped into lines.
+    /// @param size size of the data to be encoded
+    /// @param padding whether the encoded string is padded with '='
+    /// @param line_length the number of characters per line, or 0 for no
+    ///        line breaks
+    /// @param line_break the line break between the lines
+    /// @return the size of the encoded string including the line breaks
+    constexpr static std::size_t encode_size(std::size_t size, padding padding,
+                                             std::size_t line_length,
+                                             line_break line_break)
+    {
+        // There is a line break between lines, but none after the last one:
+        return encode_size(size, padding) +
+               (size == 0 || line_length == 0
+                    ? 0
+                    : (encode_size(size, padding) - 1) / line_length *
+                          (line_break == line_break::crlf ? 2 : 1));
+    }
+
     /// The size of the decoded data.
     /// @param encoded_string the encoded string
     /// @param size the size of the encoded string, must be a multiple of 4
@@ -56,6 +147,24 @@ struct base64
         return result;
     }
 
+    /// The size of the decoded data.
+    /// @param encoded_string the encoded string
+    /// @param size the size of the encoded string
+    /// @param padding whether the encoded string is padded with '='. If
+    ///        enabled, size must be a multiple of 4.
+    /// @return the size of the decoded data in bytes
+    static std::size_t decode_size(const char* encoded_string, std::size_t size,
+                                   padding padding)
+    {
+        if (padding == padding::enabled)
+        {
+            return decode_size(encoded_string, size);
+        }
+
+        // The last group holds 2 or 3 characters, which carry 1 or 2 bytes:
+        return size / 4 * 3 + (size % 4) * 3 / 4;
+    }
+
     /// The size of the decoded data.
     /// @param string the encoded string
     /// @return the size of the decoded data in bytes
@@ -64,23 +173,264 @@ struct base64
         return decode_size(string.c_str(), string.size());
     }
 
+    /// The size of the decoded data.
+    /// @param string the encoded string
+    /// @param padding whether the encoded string is padded with '='
+    /// @return the size of the decoded data in bytes
+    static std::size_t decode_size(const std::string& string, padding padding)
+    {
+        return decode_size(string.c_str(), string.size(), padding);
+    }
+
+    /// Encode data into a base64 string.
+    /// @param data the data to be encoded
+    /// @param size the size of the data to be encoded
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    /// @return the encoded string
+    static std::string encode(const uint8_t* data, std::size_t size,
+                              simd simd = simd::auto_)
+    {
+        assert(data != nullptr);
+        std::string result;
+        encode_append(data, size, result, alphabet::standard, padding::enabled,
+                      simd);
+        return result;
+    }
+
+    /// Encode data into a base64 string.
+    /// @param data the data to be encoded
+    /// @param size the size of the data to be encoded
+    /// @param alphabet the alphabet to encode with
+    /// @param padding whether to pad the encoded string with '='
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    /// @return the encoded string
+    static std::string encode(const uint8_t* data, std::size_t size,
+                              alphabet alphabet,
+                              padding padding = padding::enabled,
+                              simd simd = simd::auto_)
+    {
+        assert(data != nullptr);
+        std::string result;
+        encode_append(data, size, result, alphabet, padding, simd);
+        return result;
+    }
+
     /// Encode data into a base64 string.
     /// @param data the data to be encoded
     /// @param size the size of the data to be encoded
+    /// @param alphabet the custom alphabet to encode with
+    /// @param padding whether to pad the encoded string with '='
     /// @param simd the simd instruction set to use, by default auto is used
     ///             which will select the best available instruction set.
     /// @return the encoded string
     static std::string encode(const uint8_t* data, std::size_t size,
+                              const custom_alphabet& alphabet,
+                              padding padding = padding::enabled,
                               simd simd = simd::auto_)
     {
         assert(data != nullptr);
-        char* out = new char[encode_size(size)];
-        std::size_t encoded_size = encode(data, size, out, simd);
-        std::string result(out, encoded_size);
-        delete[] out;
+        std::string result;
+        encode_append(data, size, result, alphabet, padding, simd);
         return result;
     }
 
+    /// Encode data into a base64 string, wrapped into lines.
+    /// @param data the data to be encoded
+    /// @param size the size of the data to be encoded
+    /// @param alphabet the alphabet to encode with
+    /// @param padding whether to pad the encoded string with '='
+    /// @param line_length the number of characters per line, e.g. 64 for PEM
+    ///        or 76 for MIME, or 0 for no line breaks
+    /// @param line_break the line break between the lines
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    /// @return the encoded string
+    static std::string encode(const uint8_t* data, std::size_t size,
+                              alphabet alphabet, padding padding,
+                              std::size_t line_length, line_break line_break,
+                              simd simd = simd::auto_)
+    {
+        assert(data != nullptr);
+        std::string result(
+            encode_size(size, padding, line_length, line_break), '\0');
+        result.resize(encode(data, size, &result[0], alphabet, padding,
+                             line_length, line_break, simd));
+        return result;
+    }
+
+    /// Encode data into a base64 string, wrapped into lines.
+    /// @param data the data to be encoded
+    /// @param size the size of the data to be encoded
+    /// @param alphabet the custom alphabet to encode with
+    /// @param padding whether to pad the encoded string with '='
+    /// @param line_length the number of characters per line, or 0 for no
+    ///        line breaks
+    /// @param line_break the line break between the lines
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    /// @return the encoded string
+    static std::string encode(const uint8_t* data, std::size_t size,
+                              const custom_alphabet& alphabet,
+                              padding padding, std::size_t line_length,
+                              line_break line_break, simd simd = simd::auto_)
+    {
+        assert(data != nullptr);
+        std::string result(
+            encode_size(size, padding, line_length, line_break), '\0');
+        result.resize(encode(data, size, &result[0], alphabet, padding,
+                             line_length, line_break, simd));
+        return result;
+    }
+
+    /// Encode data and append it to a string.
+    ///
+    /// The string is resized once and the data is encoded directly into it,
+    /// so a string that is cleared and reused for every call does not
+    /// allocate once its capacity is large enough.
+    ///
+    /// @param data the data to be encoded
+    /// @param size the size of the data to be encoded
+    /// @param out the string the encoded data is appended to
+    /// @param alphabet the alphabet to encode with
+    /// @param padding whether to pad the encoded string with '='
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    /// @return the number of characters appended to out
+    /// @throws std::bad_alloc or std::length_error if out cannot grow
+    static std::size_t encode_append(const uint8_t* data, std::size_t size,
+                                     std::string& out,
+                                     alphabet alphabet = alphabet::standard,
+                                     padding padding = padding::enabled,
+                                     simd simd = simd::auto_)
+    {
+        assert(data != nullptr);
+        const std::size_t offset = out.size();
+        out.resize(offset + encode_size(size, padding));
+        const std::size_t written =
+            encode(data, size, &out[offset], alphabet, padding, simd);
+        out.resize(offset + written);
+        return written;
+    }
+
+    /// Encode data and append it to a string.
+    /// @param data the data to be encoded
+    /// @param size the size of the data to be encoded
+    /// @param out the string the encoded data is appended to
+    /// @param alphabet the custom alphabet to encode with
+    /// @param padding whether to pad the encoded string with '='
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    /// @return the number of characters appended to out
+    /// @throws std::bad_alloc or std::length_error if out cannot grow
+    static std::size_t encode_append(const uint8_t* data, std::size_t size,
+                                     std::string& out,
+                                     const custom_alphabet& alphabet,
+                                     padding padding = padding::enabled,
+                                     simd simd = simd::auto_)
+    {
+        assert(data != nullptr);
+        const std::size_t offset = out.size();
+        out.resize(offset + encode_size(size, padding));
+        const std::size_t written =
+            encode(data, size, &out[offset], alphabet, padding, simd);
+        out.resize(offset + written);
+        return written;
+    }
+
+    /// Decode a string and append the data to a vector.
+    ///
+    /// The vector is resized once and the string is decoded directly into
+    /// it, so a vector that is cleared and reused for every call does not
+    /// allocate once its capacity is large enough. On an error the vector is
+    /// left at its original size.
+    ///
+    /// @param string the encoded string
+    /// @param size the size of the encoded string
+    /// @param out the vector the decoded data is appended to
+    /// @param error a reference to an error code which will be set if an error
+    ///              occurs
+    /// @param alphabet the alphabet the string is encoded with
+    /// @param padding whether the string is padded with '='
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    /// @return the number of bytes appended to out
+    /// @throws std::bad_alloc or std::length_error if out cannot grow, in
+    ///         which case out is left unchanged
+    static std::size_t decode_append(const char* string, std::size_t size,
+                                     std::vector<uint8_t>& out,
+                                     std::error_code& error,
+                                     alphabet alphabet = alphabet::standard,
+                                     padding padding = padding::enabled,
+                                     simd simd = simd::auto_)
+    {
+        assert(string != nullptr || size == 0);
+        assert(!error);
+        const std::size_t offset = out.size();
+        // Never less than decode_size(), also when the size is invalid:
+        out.resize(offset + (size + 3) / 4 * 3);
+        const std::size_t written =
+            decode(string, size, out.data() + offset, error, alphabet,
+                   padding, simd);
+        out.resize(offset + written);
+        return written;
+    }
+
+    /// Decode a string and append the data to a vector.
+    /// @param string the encoded string
+    /// @param size the size of the encoded string
+    /// @param out the vector the decoded data is appended to
+    /// @param error a reference to an error code which will be set if an error
+    ///              occurs
+    /// @param alphabet the custom alphabet the string is encoded with
+    /// @param padding whether the string is padded with '='
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    /// @return the number of bytes appended to out
+    /// @throws std::bad_alloc or std::length_error if out cannot grow, in
+    ///         which case out is left unchanged
+    static std::size_t decode_append(const char* string, std::size_t size,
+                                     std::vector<uint8_t>& out,
+                                     std::error_code& error,
+                                     const custom_alphabet& alphabet,
+                                     padding padding = padding::enabled,
+                                     simd simd = simd::auto_)
+    {
+        assert(string != nullptr || size == 0);
+        assert(!error);
+        const std::size_t offset = out.size();
+        out.resize(offset + (size + 3) / 4 * 3);
+        const std::size_t written =
+            decode(string, size, out.data() + offset, error, alphabet,
+                   padding, simd);
+        out.resize(offset + written);
+        return written;
+    }
+
+    /// Decode a string and append the data to a vector.
+    /// @param string the encoded string
+    /// @param out the vector the decoded data is appended to
+    /// @param error a reference to an error code which will be set if an error
+    ///              occurs
+    /// @param alphabet the alphabet the string is encoded with
+    /// @param padding whether the string is padded with '='
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    /// @return the number of bytes appended to out
+    /// @throws std::bad_alloc or std::length_error if out cannot grow, in
+    ///         which case out is left unchanged
+    static std::size_t decode_append(const std::string& string,
+                                     std::vector<uint8_t>& out,
+                                     std::error_code& error,
+                                     alphabet alphabet = alphabet::standard,
+                                     padding padding = padding::enabled,
+                                     simd simd = simd::auto_)
+    {
+        return decode_append(string.data(), string.size(), out, error,
+                             alphabet, padding, simd);
+    }
+
     /// Decode base64 string into data.
     /// @param string the encoded string
     /// @param data the data to be decoded, must be at least as large as the
@@ -99,6 +449,100 @@ struct base64
         return decode(string.data(), string.size(), data, error, simd);
     }
 
+    /// Decode base64 string into data.
+    /// @param string the encoded string
+    /// @param data the data to be decoded, must be at least as large as the
+    ///             result of decode_size(string, padding)
+    /// @param error a reference to an error code which will be set if an error
+    ///              occurs
+    /// @param alphabet the alphabet the string is encoded with
+    /// @param padding whether the string is padded with '='
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    /// @return the size of the decoded data
+    static std::size_t decode(const std::string& string, uint8_t* data,
+                              std::error_code& error, alphabet alphabet,
+                              padding padding = padding::enabled,
+                              simd simd = simd::auto_) noexcept
+    {
+        assert(data != nullptr);
+        assert(!error);
+        return decode(string.data(), string.size(), data, error, alphabet,
+                      padding, simd);
+    }
+
+    /// Decode base64 string into data.
+    /// @param string the encoded string
+    /// @param data the data to be decoded, must be at least as large as the
+    ///             result of decode_size(string, padding)
+    /// @param error a reference to an error code which will be set if an error
+    ///              occurs
+    /// @param alphabet the custom alphabet the string is encoded with
+    /// @param padding whether the string is padded with '='
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    /// @return the size of the decoded data
+    static std::size_t decode(const std::string& string, uint8_t* data,
+                              std::error_code& error,
+                              const custom_alphabet& alphabet,
+                              padding padding = padding::enabled,
+                              simd simd = simd::auto_) noexcept
+    {
+        assert(data != nullptr);
+        assert(!error);
+        return decode(string.data(), string.size(), data, error, alphabet,
+                      padding, simd);
+    }
+
+    /// Decode base64 string into data.
+    /// @param string the encoded string
+    /// @param data the data to be decoded, must be at least as large as the
+    ///             result of decode_size(string, padding::disabled) when
+    ///             whitespace is ignored
+    /// @param error a reference to an error code which will be set if an error
+    ///              occurs
+    /// @param alphabet the alphabet the string is encoded with
+    /// @param padding whether the string is padded with '='
+    /// @param whitespace whether whitespace in the string is skipped
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    /// @return the size of the decoded data
+    static std::size_t decode(const std::string& string, uint8_t* data,
+                              std::error_code& error, alphabet alphabet,
+                              padding padding, whitespace whitespace,
+                              simd simd = simd::auto_) noexcept
+    {
+        assert(data != nullptr);
+        assert(!error);
+        return decode(string.data(), string.size(), data, error, alphabet,
+                      padding, whitespace, simd);
+    }
+
+    /// Decode base64 string into data.
+    /// @param string the encoded string
+    /// @param data the data to be decoded, must be at least as large as the
+    ///             result of decode_size(string, padding::disabled) when
+    ///             whitespace is ignored
+    /// @param error a reference to an error code which will be set if an error
+    ///              occurs
+    /// @param alphabet the custom alphabet the string is encoded with
+    /// @param padding whether the string is padded with '='
+    /// @param whitespace whether whitespace in the string is skipped
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    /// @return the size of the decoded data
+    static std::size_t decode(const std::string& string, uint8_t* data,
+                              std::error_code& error,
+                              const custom_alphabet& alphabet,
+                              padding padding, whitespace whitespace,
+                              simd simd = simd::auto_) noexcept
+    {
+        assert(data != nullptr);
+        assert(!error);
+        return decode(string.data(), string.size(), data, error, alphabet,
+                      padding, whitespace, simd);
+    }
+
     /// Decode base64 string into data.
     /// @param string the encoded string
     /// @param data the data to be decoded
@@ -142,6 +586,606 @@ struct base64
     static std::size_t decode(const char* string, std::size_t size,
                               uint8_t* out, std::error_code& error,
                               simd simd = simd::auto_) noexcept;
+
+    /// Encode a pointer and size to a base64 encoded string
+    ///
+    /// @param data a pointer to the data
+    /// @param size the size of the data in bytes
+    /// @param out the output string, must hold at least
+    ///            encode_size(size, padding) characters
+    /// @param alphabet the alphabet to encode with
+    /// @param padding whether to pad the encoded string with '='
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    /// @return the number of bytes written to the data pointer
+    static std::size_t encode(const uint8_t* data, std::size_t size, char* out,
+                              alphabet alphabet,
+                              padding padding = padding::enabled,
+                              simd simd = simd::auto_);
+
+    /// Decode a base64 encoded string to a given pointer
+    ///
+    /// @param string the encoded string
+    /// @param size the size of the encoded string
+    /// @param out a pointer to the output data
+    /// @param error a reference to an error code which will be set if an error
+    ///              occurs. A padded string must have a size that is a
+    ///              multiple of 4, an unpadded string must not contain '='.
+    /// @param alphabet the alphabet the string is encoded with
+    /// @param padding whether the string is padded with '='
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    /// @return the number of bytes written to the data pointer
+    static std::size_t decode(const char* string, std::size_t size,
+                              uint8_t* out, std::error_code& error,
+                              alphabet alphabet,
+                              padding padding = padding::enabled,
+                              simd simd = simd::auto_) noexcept;
+
+    /// Encode a pointer and size to a base64 encoded string
+    ///
+    /// @param data a pointer to the data
+    /// @param size the size of the data in bytes
+    /// @param out the output string, must hold at least
+    ///            encode_size(size, padding) characters
+    /// @param alphabet the custom alphabet to encode with
+    /// @param padding whether to pad the encoded string with '='
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    /// @return the number of bytes written to the data pointer
+    static std::size_t encode(const uint8_t* data, std::size_t size, char* out,
+                              const custom_alphabet& alphabet,
+                              padding padding = padding::enabled,
+                              simd simd = simd::auto_);
+
+    /// Decode a base64 encoded string to a given pointer
+    ///
+    /// @param string the encoded string
+    /// @param size the size of the encoded string
+    /// @param out a pointer to the output data
+    /// @param error a reference to an error code which will be set if an error
+    ///              occurs
+    /// @param alphabet the custom alphabet the string is encoded with
+    /// @param padding whether the string is padded with '='
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    /// @return the number of bytes written to the data pointer
+    static std::size_t decode(const char* string, std::size_t size,
+                              uint8_t* out, std::error_code& error,
+                              const custom_alphabet& alphabet,
+                              padding padding = padding::enabled,
+                              simd simd = simd::auto_) noexcept;
+
+    /// Decode a base64 encoded string to a given pointer, and report where
+    /// an invalid string goes wrong
+    ///
+    /// Decoding stops at the first invalid character, so rejecting a string
+    /// costs at most as much as decoding it.
+    ///
+    /// @param string the encoded string
+    /// @param size the size of the encoded string
+    /// @param out a pointer to the output data
+    /// @param error a reference to an error code which will be set if an error
+    ///              occurs
+    /// @param error_offset set to the offset of the first character that
+    ///        cannot be decoded if an error occurs. If the string is invalid
+    ///        because of its size, this is the size of the string.
+    /// @param alphabet the alphabet the string is encoded with
+    /// @param padding whether the string is padded with '='
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    /// @return the number of bytes written to the data pointer
+    static std::size_t decode(const char* string, std::size_t size,
+                              uint8_t* out, std::error_code& error,
+                              std::size_t& error_offset,
+                              alphabet alphabet = alphabet::standard,
+                              padding padding = padding::enabled,
+                              simd simd = simd::auto_) noexcept;
+
+    /// Decode a base64 encoded string to a given pointer, and report where
+    /// an invalid string goes wrong
+    ///
+    /// @param string the encoded string
+    /// @param size the size of the encoded string
+    /// @param out a pointer to the output data
+    /// @param error a reference to an error code which will be set if an error
+    ///              occurs
+    /// @param error_offset set to the offset of the first character that
+    ///        cannot be decoded if an error occurs. If the string is invalid
+    ///        because of its size, this is the size of the string.
+    /// @param alphabet the custom alphabet the string is encoded with
+    /// @param padding whether the string is padded with '='
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    /// @return the number of bytes written to the data pointer
+    static std::size_t decode(const char* string, std::size_t size,
+                              uint8_t* out, std::error_code& error,
+                              std::size_t& error_offset,
+                              const custom_alphabet& alphabet,
+                              padding padding = padding::enabled,
+                              simd simd = simd::auto_) noexcept;
+
+    /// Encode a pointer and size to a base64 encoded string, wrapped into
+    /// lines
+    ///
+    /// A line break is inserted after every line_length characters, except
+    /// at the end of the string. The string can be decoded again with
+    /// whitespace::ignore.
+    ///
+    /// @param data a pointer to the data
+    /// @param size the size of the data in bytes
+    /// @param out the output string, must hold at least
+    ///            encode_size(size, padding, line_length, line_break)
+    ///            characters
+    /// @param alphabet the alphabet to encode with
+    /// @param padding whether to pad the encoded string with '='
+    /// @param line_length the number of characters per line, e.g. 64 for PEM
+    ///        or 76 for MIME, or 0 for no line breaks
+    /// @param line_break the line break between the lines
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    /// @return the number of bytes written to the data pointer
+    static std::size_t encode(const uint8_t* data, std::size_t size, char* out,
+                              alphabet alphabet, padding padding,
+                              std::size_t line_length, line_break line_break,
+                              simd simd = simd::auto_);
+
+    /// Encode a pointer and size to a base64 encoded string, wrapped into
+    /// lines
+    ///
+    /// @param data a pointer to the data
+    /// @param size the size of the data in bytes
+    /// @param out the output string, must hold at least
+    ///            encode_size(size, padding, line_length, line_break)
+    ///            characters
+    /// @param alphabet the custom alphabet to encode with
+    /// @param padding whether to pad the encoded string with '='
+    /// @param line_length the number of characters per line, or 0 for no
+    ///        line breaks
+    /// @param line_break the line break between the lines
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    /// @return the number of bytes written to the data pointer
+    static std::size_t encode(const uint8_t* data, std::size_t size, char* out,
+                              const custom_alphabet& alphabet,
+                              padding padding, std::size_t line_length,
+                              line_break line_break, simd simd = simd::auto_);
+
+    /// Decode a base64 encoded string, which may contain whitespace, to a
+    /// given pointer
+    ///
+    /// With whitespace::ignore the string is decoded as if its whitespace
+    /// was removed, so padding and the size requirements apply to the
+    /// remaining characters. Since the number of whitespace characters is
+    /// not known up front, decode_size(size, padding::disabled) is used as
+    /// an upper bound for the size of the output.
+    ///
+    /// @param string the encoded string
+    /// @param size the size of the encoded string
+    /// @param out a pointer to the output data
+    /// @param error a reference to an error code which will be set if an error
+    ///              occurs
+    /// @param alphabet the alphabet the string is encoded with
+    /// @param padding whether the string is padded with '='
+    /// @param whitespace whether whitespace in the string is skipped
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    /// @return the number of bytes written to the data pointer
+    static std::size_t decode(const char* string, std::size_t size,
+                              uint8_t* out, std::error_code& error,
+                              alphabet alphabet, padding padding,
+                              whitespace whitespace,
+                              simd simd = simd::auto_) noexcept;
+
+    /// Decode a base64 encoded string, which may contain whitespace, to a
+    /// given pointer
+    ///
+    /// @param string the encoded string
+    /// @param size the size of the encoded string
+    /// @param out a pointer to the output data
+    /// @param error a reference to an error code which will be set if an error
+    ///              occurs
+    /// @param alphabet the custom alphabet the string is encoded with
+    /// @param padding whether the string is padded with '='
+    /// @param whitespace whether whitespace in the string is skipped
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    /// @return the number of bytes written to the data pointer
+    static std::size_t decode(const char* string, std::size_t size,
+                              uint8_t* out, std::error_code& error,
+                              const custom_alphabet& alphabet,
+                              padding padding, whitespace whitespace,
+                              simd simd = simd::auto_) noexcept;
+
+    /// Check whether a string can be decoded, without decoding it
+    ///
+    /// Only the character classification of the decoder runs, so this is
+    /// faster than decoding into a scratch buffer. The string is valid if
+    /// and only if decode() would succeed with the same arguments.
+    ///
+    /// @param string the encoded string
+    /// @param size the size of the encoded string
+    /// @param error a reference to an error code which will be set if the
+    ///              string cannot be decoded
+    /// @param alphabet the alphabet the string is encoded with
+    /// @param padding whether the string is padded with '='
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    static void validate(const char* string, std::size_t size,
+                         std::error_code& error,
+                         alphabet alphabet = alphabet::standard,
+                         padding padding = padding::enabled,
+                         simd simd = simd::auto_) noexcept;
+
+    /// Check whether a string can be decoded, without decoding it
+    ///
+    /// @param string the encoded string
+    /// @param size the size of the encoded string
+    /// @param error a reference to an error code which will be set if the
+    ///              string cannot be decoded
+    /// @param alphabet the custom alphabet the string is encoded with
+    /// @param padding whether the string is padded with '='
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    static void validate(const char* string, std::size_t size,
+                         std::error_code& error,
+                         const custom_alphabet& alphabet,
+                         padding padding = padding::enabled,
+                         simd simd = simd::auto_) noexcept;
+
+    /// Check whether a string can be decoded, without decoding it
+    /// @param string the encoded string
+    /// @param size the size of the encoded string
+    /// @param alphabet the alphabet the string is encoded with
+    /// @param padding whether the string is padded with '='
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    /// @return true if decode() would succeed
+    static bool is_valid(const char* string, std::size_t size,
+                         alphabet alphabet = alphabet::standard,
+                         padding padding = padding::enabled,
+                         simd simd = simd::auto_) noexcept
+    {
+        std::error_code error;
+        validate(string, size, error, alphabet, padding, simd);
+        return !error;
+    }
+
+    /// Check whether a string can be decoded, without decoding it
+    /// @param string the encoded string
+    /// @param alphabet the alphabet the string is encoded with
+    /// @param padding whether the string is padded with '='
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    /// @return true if decode() would succeed
+    static bool is_valid(const std::string& string,
+                         alphabet alphabet = alphabet::standard,
+                         padding padding = padding::enabled,
+                         simd simd = simd::auto_) noexcept
+    {
+        return is_valid(string.data(), string.size(), alphabet, padding, simd);
+    }
+
+    /// Check whether a string can be decoded, without decoding it
+    /// @param string the encoded string
+    /// @param alphabet the custom alphabet the string is encoded with
+    /// @param padding whether the string is padded with '='
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    /// @return true if decode() would succeed
+    static bool is_valid(const std::string& string,
+                         const custom_alphabet& alphabet,
+                         padding padding = padding::enabled,
+                         simd simd = simd::auto_) noexcept
+    {
+        std::error_code error;
+        validate(string.data(), string.size(), error, alphabet, padding, simd);
+        return !error;
+    }
+
+    /// Decode a base64 encoded string in place, overwriting it with the
+    /// decoded data.
+    ///
+    /// The decoded data is written to the start of the string. The
+    /// characters after the decoded data are unspecified afterwards, also
+    /// when an error occurs. Decoding in place always runs on the calling
+    /// thread, see set_threads().
+    ///
+    /// @param string the encoded string, which holds the decoded data
+    ///        afterwards
+    /// @param size the size of the encoded string
+    /// @param error a reference to an error code which will be set if an error
+    ///              occurs
+    /// @param alphabet the alphabet the string is encoded with
+    /// @param padding whether the string is padded with '='
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    /// @return the size of the decoded data
+    static std::size_t decode_inplace(char* string, std::size_t size,
+                                      std::error_code& error,
+                                      alphabet alphabet = alphabet::standard,
+                                      padding padding = padding::enabled,
+                                      simd simd = simd::auto_) noexcept;
+
+    /// Decode a base64 encoded string in place, overwriting it with the
+    /// decoded data.
+    ///
+    /// @param string the encoded string, which holds the decoded data
+    ///        afterwards
+    /// @param size the size of the encoded string
+    /// @param error a reference to an error code which will be set if an error
+    ///              occurs
+    /// @param alphabet the custom alphabet the string is encoded with
+    /// @param padding whether the string is padded with '='
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    /// @return the size of the decoded data
+    static std::size_t decode_inplace(char* string, std::size_t size,
+                                      std::error_code& error,
+                                      const custom_alphabet& alphabet,
+                                      padding padding = padding::enabled,
+                                      simd simd = simd::auto_) noexcept;
+
+    /// Encode data in place, overwriting it with the base64 encoded string.
+    ///
+    /// The data is read from the start of the buffer and the encoded string
+    /// is written to the start of the same buffer, from the back to the
+    /// front, so the buffer must have room for the whole string. Encoding in
+    /// place always runs on the calling thread, see set_threads().
+    ///
+    /// @param buffer the buffer holding the data at its start, which holds
+    ///        the encoded string afterwards
+    /// @param size the size of the data
+    /// @param capacity the size of the buffer, at least
+    ///        encode_size(size, padding)
+    /// @param alphabet the alphabet to encode with
+    /// @param padding whether to pad the encoded string with '='
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    /// @return the size of the encoded string
+    /// @throws std::invalid_argument if capacity is smaller than
+    ///         encode_size(size, padding)
+    static std::size_t encode_inplace(uint8_t* buffer, std::size_t size,
+                                      std::size_t capacity,
+                                      alphabet alphabet = alphabet::standard,
+                                      padding padding = padding::enabled,
+                                      simd simd = simd::auto_);
+
+    /// Encode data in place with a custom alphabet, overwriting it with the
+    /// base64 encoded string.
+    ///
+    /// @param buffer the buffer holding the data at its start, which holds
+    ///        the encoded string afterwards
+    /// @param size the size of the data
+    /// @param capacity the size of the buffer, at least
+    ///        encode_size(size, padding)
+    /// @param alphabet the custom alphabet to encode with
+    /// @param padding whether to pad the encoded string with '='
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    /// @return the size of the encoded string
+    /// @throws std::invalid_argument if capacity is smaller than
+    ///         encode_size(size, padding)
+    static std::size_t encode_inplace(uint8_t* buffer, std::size_t size,
+                                      std::size_t capacity,
+                                      const custom_alphabet& alphabet,
+                                      padding padding = padding::enabled,
+                                      simd simd = simd::auto_);
+
+    /// The size of an encoded column.
+    /// @param offsets the count + 1 offsets of the values in the data column
+    /// @param count the number of values
+    /// @param padding whether the encoded values are padded with '='
+    /// @return the size of the encoded column
+    static std::size_t encode_batch_size(const uint32_t* offsets,
+                                         std::size_t count, padding padding)
+    {
+        assert(offsets != nullptr);
+        std::size_t result = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            result += encode_size(offsets[i + 1] - offsets[i], padding);
+        }
+        return result;
+    }
+
+    /// The size of a decoded column.
+    /// @param column the encoded values, stored back to back
+    /// @param offsets the count + 1 offsets of the values in column
+    /// @param count the number of values
+    /// @param padding whether the encoded values are padded with '='
+    /// @return the size of the decoded column in bytes
+    static std::size_t decode_batch_size(const char* column,
+                                         const uint32_t* offsets,
+                                         std::size_t count, padding padding)
+    {
+        assert(column != nullptr);
+        assert(offsets != nullptr);
+        std::size_t result = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const std::size_t size = offsets[i + 1] - offsets[i];
+            if (padding == padding::enabled && size % 4 != 0)
+            {
+                // Invalid, which decode_batch reports:
+                continue;
+            }
+            result += decode_size(column + offsets[i], size, padding);
+        }
+        return result;
+    }
+
+    /// Encode a column of values, e.g. the values of an Arrow binary array.
+    ///
+    /// Value i of the column is the data from offsets[i] up to
+    /// offsets[i + 1], and is encoded to the characters from out_offsets[i]
+    /// up to out_offsets[i + 1] of the output column. The codec is selected
+    /// once for the whole batch, and the values are encoded without any
+    /// allocations.
+    ///
+    /// @param data the values, stored back to back
+    /// @param offsets the count + 1 offsets of the values in data
+    /// @param count the number of values
+    /// @param out the output column, must hold at least
+    ///            encode_batch_size(offsets, count, padding) characters
+    /// @param out_offsets the count + 1 offsets of the encoded values in out,
+    ///        written by the call. The first offset is 0.
+    /// @param error a reference to an error code which will be set to
+    ///              std::errc::value_too_large if the output column would
+    ///              not fit 32-bit offsets. Encoding stops before the value
+    ///              that does not fit, and only the offsets of the values
+    ///              before it are written.
+    /// @param alphabet the alphabet to encode with
+    /// @param padding whether to pad the encoded values with '='
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    /// @return the size of the output column, or 0 if an error occurs
+    static std::size_t encode_batch(const uint8_t* data,
+                                    const uint32_t* offsets, std::size_t count,
+                                    char* out, uint32_t* out_offsets,
+                                    std::error_code& error,
+                                    alphabet alphabet = alphabet::standard,
+                                    padding padding = padding::enabled,
+                                    simd simd = simd::auto_);
+
+    /// Encode a column of values with a custom alphabet.
+    ///
+    /// @param data the values, stored back to back
+    /// @param offsets the count + 1 offsets of the values in data
+    /// @param count the number of values
+    /// @param out the output column, must hold at least
+    ///            encode_batch_size(offsets, count, padding) characters
+    /// @param out_offsets the count + 1 offsets of the encoded values in out,
+    ///        written by the call. The first offset is 0.
+    /// @param error a reference to an error code which will be set to
+    ///              std::errc::value_too_large if the output column would
+    ///              not fit 32-bit offsets. Encoding stops before the value
+    ///              that does not fit, and only the offsets of the values
+    ///              before it are written.
+    /// @param alphabet the custom alphabet to encode with
+    /// @param padding whether to pad the encoded values with '='
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    /// @return the size of the output column, or 0 if an error occurs
+    static std::size_t encode_batch(const uint8_t* data,
+                                    const uint32_t* offsets, std::size_t count,
+                                    char* out, uint32_t* out_offsets,
+                                    std::error_code& error,
+                                    const custom_alphabet& alphabet,
+                                    padding padding = padding::enabled,
+                                    simd simd = simd::auto_);
+
+    /// Decode a column of encoded values.
+    ///
+    /// Value i of the column is the characters from offsets[i] up to
+    /// offsets[i + 1], and is decoded to the bytes from out_offsets[i] up to
+    /// out_offsets[i + 1] of the output column. The codec is selected once
+    /// for the whole batch.
+    ///
+    /// @param column the encoded values, stored back to back
+    /// @param offsets the count + 1 offsets of the values in column
+    /// @param count the number of values
+    /// @param out the output column, must hold at least
+    ///            decode_batch_size(column, offsets, count, padding) bytes
+    /// @param out_offsets the count + 1 offsets of the decoded values in out,
+    ///        written by the call. The first offset is 0.
+    /// @param error a reference to an error code which will be set if an error
+    ///              occurs. Decoding stops at the first invalid value, and
+    ///              only the offsets of the values before it are written.
+    /// @param alphabet the alphabet the values are encoded with
+    /// @param padding whether the values are padded with '='
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    /// @return the size of the output column, or 0 if an error occurs
+    static std::size_t decode_batch(const char* column,
+                                    const uint32_t* offsets, std::size_t count,
+                                    uint8_t* out, uint32_t* out_offsets,
+                                    std::error_code& error,
+                                    alphabet alphabet = alphabet::standard,
+                                    padding padding = padding::enabled,
+                                    simd simd = simd::auto_) noexcept;
+
+    /// Decode a column of encoded values, and report which value is invalid
+    ///
+    /// @param column the encoded values, stored back to back
+    /// @param offsets the count + 1 offsets of the values in column
+    /// @param count the number of values
+    /// @param out the output column, must hold at least
+    ///            decode_batch_size(column, offsets, count, padding) bytes
+    /// @param out_offsets the count + 1 offsets of the decoded values in out,
+    ///        written by the call. The first offset is 0.
+    /// @param error a reference to an error code which will be set if an error
+    ///              occurs. Decoding stops at the first invalid value, and
+    ///              only the offsets of the values before it are written.
+    /// @param error_index set to the index of the first invalid value if an
+    ///        error occurs
+    /// @param alphabet the alphabet the values are encoded with
+    /// @param padding whether the values are padded with '='
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    /// @return the size of the output column, or 0 if an error occurs
+    static std::size_t decode_batch(const char* column,
+                                    const uint32_t* offsets, std::size_t count,
+                                    uint8_t* out, uint32_t* out_offsets,
+                                    std::error_code& error,
+                                    std::size_t& error_index,
+                                    alphabet alphabet = alphabet::standard,
+                                    padding padding = padding::enabled,
+                                    simd simd = simd::auto_) noexcept;
+
+    /// Decode a column of values encoded with a custom alphabet.
+    ///
+    /// @param column the encoded values, stored back to back
+    /// @param offsets the count + 1 offsets of the values in column
+    /// @param count the number of values
+    /// @param out the output column, must hold at least
+    ///            decode_batch_size(column, offsets, count, padding) bytes
+    /// @param out_offsets the count + 1 offsets of the decoded values in out,
+    ///        written by the call. The first offset is 0.
+    /// @param error a reference to an error code which will be set if an error
+    ///              occurs. Decoding stops at the first invalid value, and
+    ///              only the offsets of the values before it are written.
+    /// @param alphabet the custom alphabet the values are encoded with
+    /// @param padding whether the values are padded with '='
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    /// @return the size of the output column, or 0 if an error occurs
+    static std::size_t decode_batch(const char* column,
+                                    const uint32_t* offsets, std::size_t count,
+                                    uint8_t* out, uint32_t* out_offsets,
+                                    std::error_code& error,
+                                    const custom_alphabet& alphabet,
+                                    padding padding = padding::enabled,
+                                    simd simd = simd::auto_) noexcept;
+
+    /// Decode a column of values encoded with a custom alphabet, and report
+    /// which value is invalid
+    ///
+    /// @param column the encoded values, stored back to back
+    /// @param offsets the count + 1 offsets of the values in column
+    /// @param count the number of values
+    /// @param out the output column, must hold at least
+    ///            decode_batch_size(column, offsets, count, padding) bytes
+    /// @param out_offsets the count + 1 offsets of the decoded values in out,
+    ///        written by the call. The first offset is 0.
+    /// @param error a reference to an error code which will be set if an error
+    ///              occurs. Decoding stops at the first invalid value, and
+    ///              only the offsets of the values before it are written.
+    /// @param error_index set to the index of the first invalid value if an
+    ///        error occurs
+    /// @param alphabet the custom alphabet the values are encoded with
+    /// @param padding whether the values are padded with '='
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    /// @return the size of the output column, or 0 if an error occurs
+    static std::size_t decode_batch(const char* column,
+                                    const uint32_t* offsets, std::size_t count,
+                                    uint8_t* out, uint32_t* out_offsets,
+                                    std::error_code& error,
+                                    std::size_t& error_index,
+                                    const custom_alphabet& alphabet,
+                                    padding padding = padding::enabled,
+                                    simd simd = simd::auto_) noexcept;
 };
 }
 }
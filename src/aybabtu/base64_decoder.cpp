@@ -0,0 +1,151 @@
+// Copyright (c) Steinwurf ApS 2016.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include "base64_decoder.hpp"
+#include "base64.hpp"
+
+#include "version.hpp"
+
+#include <cassert>
+#include <cstdint>
+
+namespace aybabtu
+{
+inline namespace STEINWURF_AYBABTU_VERSION
+{
+base64_decoder::base64_decoder(simd simd) : m_simd(simd)
+{
+}
+
+std::size_t base64_decoder::update_size(std::size_t size) const
+{
+    return (m_buffered + size) / 4 * 3;
+}
+
+std::size_t base64_decoder::update(const char* data, std::size_t size,
+                                   uint8_t* out, std::error_code& error)
+{
+    assert(data != nullptr || size == 0);
+    assert(out != nullptr || update_size(size) == 0);
+    assert(!error);
+
+    if (m_failed)
+    {
+        error = std::make_error_code(std::errc::invalid_argument);
+        return 0;
+    }
+
+    std::size_t written = 0;
+
+    // Complete the group carried over from the previous call:
+    if (m_buffered > 0)
+    {
+        std::size_t position = m_position - m_buffered;
+        while (m_buffered < 4 && size > 0)
+        {
+            m_buffer[m_buffered++] = *data++;
+            m_position++;
+            size--;
+        }
+        if (m_buffered < 4)
+        {
+            return 0;
+        }
+        m_buffered = 0;
+        written += decode(m_buffer, 4, position, out, error);
+        if (error)
+        {
+            return 0;
+        }
+    }
+
+    // Decode the whole groups in one go, so the bulk of the fragment is
+    // handled by the simd loops:
+    std::size_t whole = size - size % 4;
+    if (whole > 0)
+    {
+        written += decode(data, whole, m_position, out + written, error);
+        if (error)
+        {
+            return 0;
+        }
+        m_position += whole;
+    }
+
+    // Keep the trailing characters for the next call:
+    for (std::size_t i = whole; i < size; ++i)
+    {
+        m_buffer[m_buffered++] = data[i];
+        m_position++;
+    }
+
+    return written;
+}
+
+void base64_decoder::finish(std::error_code& error)
+{
+    assert(!error);
+
+    if (m_failed)
+    {
+        error = std::make_error_code(std::errc::invalid_argument);
+    }
+    else if (m_buffered > 0)
+    {
+        fail(m_position, error);
+        return;
+    }
+    reset();
+}
+
+void base64_decoder::reset()
+{
+    m_buffered = 0;
+    m_position = 0;
+    m_padded = false;
+    m_failed = false;
+}
+
+std::size_t base64_decoder::error_offset() const
+{
+    return m_error_offset;
+}
+
+std::size_t base64_decoder::decode(const char* data, std::size_t size,
+                                   std::size_t position, uint8_t* out,
+                                   std::error_code& error)
+{
+    assert(size > 0 && size % 4 == 0);
+
+    // Nothing may follow the padding:
+    if (m_padded)
+    {
+        fail(position, error);
+        return 0;
+    }
+
+    std::size_t error_offset = 0;
+    std::size_t written =
+        base64::decode(data, size, out, error, error_offset,
+                       alphabet::standard, padding::enabled, m_simd);
+    if (error)
+    {
+        m_failed = true;
+        m_error_offset = position + error_offset;
+        return 0;
+    }
+
+    m_padded = data[size - 1] == '=';
+    return written;
+}
+
+void base64_decoder::fail(std::size_t offset, std::error_code& error)
+{
+    error = std::make_error_code(std::errc::invalid_argument);
+    m_failed = true;
+    m_error_offset = offset;
+}
+}
+}
@@ -0,0 +1,97 @@
+// Copyright (c) Steinwurf ApS 2016.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <cstdint>
+#include <system_error>
+
+#include "simd.hpp"
+
+#include "version.hpp"
+
+namespace aybabtu
+{
+inline namespace STEINWURF_AYBABTU_VERSION
+{
+/// Resumable base64 decoder for encoded text that arrives in fragments.
+///
+/// Fragments may be split anywhere, also inside a 4-character group or
+/// between a group and its padding. Incomplete groups are kept until the
+/// next call, and the complete groups in the middle of each fragment are
+/// decoded by the selected simd codec.
+class base64_decoder
+{
+public:
+    /// Create a new decoder
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    base64_decoder(simd simd = simd::auto_);
+
+    /// The maximum number of bytes written by update()
+    /// @param size the size of the fragment passed to update()
+    /// @return the maximum number of bytes update() will write
+    std::size_t update_size(std::size_t size) const;
+
+    /// Decode a fragment of encoded text. Any trailing characters which do
+    /// not form a complete 4-character group are kept until the next call.
+    /// @param data the encoded fragment
+    /// @param size the size of the fragment
+    /// @param out the output buffer, must be at least update_size(size)
+    ///            bytes
+    /// @param error a reference to an error code which will be set if an
+    ///              error occurs. Once an error has occurred every call fails
+    ///              until the decoder is reset.
+    /// @return the number of bytes written to out
+    std::size_t update(const char* data, std::size_t size, uint8_t* out,
+                       std::error_code& error);
+
+    /// End the stream. If the stream is valid the decoder is reset so it can
+    /// be used for a new stream.
+    /// @param error a reference to an error code which will be set if the
+    ///              stream ended inside a 4-character group
+    void finish(std::error_code& error);
+
+    /// Discard any buffered characters and start a new stream
+    void reset();
+
+    /// @return the offset in the stream of the character which caused the
+    ///         last error. If the stream ended inside a 4-character group
+    ///         this is the size of the stream.
+    std::size_t error_offset() const;
+
+private:
+    /// Decode complete 4-character groups
+    std::size_t decode(const char* data, std::size_t size,
+                       std::size_t position, uint8_t* out,
+                       std::error_code& error);
+
+    /// Enter the failed state
+    void fail(std::size_t offset, std::error_code& error);
+
+private:
+    /// The simd instruction set to use
+    simd m_simd;
+
+    /// The characters carried over from the previous call to update()
+    char m_buffer[4];
+
+    /// The number of characters in m_buffer
+    std::size_t m_buffered = 0;
+
+    /// The number of characters received in the stream so far
+    std::size_t m_position = 0;
+
+    /// Whether the padding of the final group has been seen
+    bool m_padded = false;
+
+    /// Whether an error has occurred
+    bool m_failed = false;
+
+    /// The offset of the character which caused the last error
+    std::size_t m_error_offset = 0;
+};
+}
+}
@@ -0,0 +1,89 @@
+// Copyright (c) Steinwurf ApS 2016.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include "base64_encoder.hpp"
+#include "base64.hpp"
+
+#include "version.hpp"
+
+#include <cassert>
+#include <cstdint>
+
+namespace aybabtu
+{
+inline namespace STEINWURF_AYBABTU_VERSION
+{
+constexpr std::size_t base64_encoder::finish_size;
+
+base64_encoder::base64_encoder(simd simd) : m_simd(simd)
+{
+}
+
+std::size_t base64_encoder::update_size(std::size_t size) const
+{
+    return (m_buffered + size) / 3 * 4;
+}
+
+std::size_t base64_encoder::update(const uint8_t* data, std::size_t size,
+                                   char* out)
+{
+    assert(data != nullptr || size == 0);
+    assert(out != nullptr || update_size(size) == 0);
+
+    std::size_t written = 0;
+
+    // Complete the group carried over from the previous call:
+    if (m_buffered > 0)
+    {
+        while (m_buffered < 3 && size > 0)
+        {
+            m_buffer[m_buffered++] = *data++;
+            size--;
+        }
+        if (m_buffered < 3)
+        {
+            return 0;
+        }
+        written += base64::encode(m_buffer, 3, out, m_simd);
+        m_buffered = 0;
+    }
+
+    // Encode the whole groups in one go, so the bulk of the chunk is handled
+    // by the simd loops. Since the size is a multiple of 3 no padding is
+    // written:
+    std::size_t whole = size - size % 3;
+    if (whole > 0)
+    {
+        written += base64::encode(data, whole, out + written, m_simd);
+    }
+
+    // Keep the trailing bytes for the next call:
+    for (std::size_t i = whole; i < size; ++i)
+    {
+        m_buffer[m_buffered++] = data[i];
+    }
+
+    return written;
+}
+
+std::size_t base64_encoder::finish(char* out)
+{
+    assert(out != nullptr);
+
+    std::size_t written = 0;
+    if (m_buffered > 0)
+    {
+        written = base64::encode(m_buffer, m_buffered, out, m_simd);
+    }
+    reset();
+    return written;
+}
+
+void base64_encoder::reset()
+{
+    m_buffered = 0;
+}
+}
+}
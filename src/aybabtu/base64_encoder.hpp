@@ -0,0 +1,68 @@
+// Copyright (c) Steinwurf ApS 2016.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <cstdint>
+
+#include "simd.hpp"
+
+#include "version.hpp"
+
+namespace aybabtu
+{
+inline namespace STEINWURF_AYBABTU_VERSION
+{
+/// Resumable base64 encoder for data that arrives in chunks.
+///
+/// The encoder carries the 0-2 bytes that do not form a complete 3-byte
+/// group over to the next call, so the output of the calls to update()
+/// followed by finish() is identical to encoding all the data at once with
+/// base64::encode().
+class base64_encoder
+{
+public:
+    /// Create a new encoder
+    /// @param simd the simd instruction set to use, by default auto is used
+    ///             which will select the best available instruction set.
+    base64_encoder(simd simd = simd::auto_);
+
+    /// The number of characters written by update()
+    /// @param size the size of the data passed to update()
+    /// @return the number of characters update() will write
+    std::size_t update_size(std::size_t size) const;
+
+    /// The maximum number of characters written by finish()
+    static constexpr std::size_t finish_size = 4;
+
+    /// Encode a chunk of data. Any trailing bytes which do not form a
+    /// complete 3-byte group are kept until the next call.
+    /// @param data a pointer to the data
+    /// @param size the size of the data in bytes
+    /// @param out the output buffer, must be at least update_size(size) bytes
+    /// @return the number of characters written to out
+    std::size_t update(const uint8_t* data, std::size_t size, char* out);
+
+    /// Encode the remaining bytes, including padding, and reset the encoder
+    /// so it can be used for a new stream.
+    /// @param out the output buffer, must be at least finish_size bytes
+    /// @return the number of characters written to out
+    std::size_t finish(char* out);
+
+    /// Discard any buffered bytes and start a new stream
+    void reset();
+
+private:
+    /// The simd instruction set to use
+    simd m_simd;
+
+    /// The bytes carried over from the previous call to update()
+    uint8_t m_buffer[3];
+
+    /// The number of bytes in m_buffer
+    std::size_t m_buffered = 0;
+};
+}
+}
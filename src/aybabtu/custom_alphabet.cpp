@@ -0,0 +1,74 @@
+// Copyright (c) Steinwurf ApS 2016.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include "custom_alphabet.hpp"
+
+#include "detail/strip_whitespace.hpp"
+#include "version.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+
+namespace aybabtu
+{
+inline namespace STEINWURF_AYBABTU_VERSION
+{
+bool custom_alphabet::is_valid(const std::string& characters)
+{
+    if (characters.size() != 64)
+    {
+        return false;
+    }
+
+    bool seen[128] = {false};
+    for (char c : characters)
+    {
+        const uint8_t u = static_cast<uint8_t>(c);
+        if (u >= 128 || c == '=' || detail::is_whitespace(u) || seen[u])
+        {
+            return false;
+        }
+        seen[u] = true;
+    }
+    return true;
+}
+
+custom_alphabet::custom_alphabet(const std::string& characters)
+{
+    if (!is_valid(characters))
+    {
+        throw std::invalid_argument(
+            "aybabtu::custom_alphabet: the characters must be 64 distinct "
+            "ASCII characters other than '=' and whitespace");
+    }
+
+    std::fill(m_decode, m_decode + sizeof(m_decode), 255);
+    m_decode[static_cast<uint8_t>('=')] = 254;
+
+    for (uint8_t value = 0; value < 64; ++value)
+    {
+        const uint8_t c = static_cast<uint8_t>(characters[value]);
+        m_encode[value] = c;
+        m_decode[c] = value;
+    }
+}
+
+std::string custom_alphabet::characters() const
+{
+    return std::string(m_encode, m_encode + sizeof(m_encode));
+}
+
+const uint8_t* custom_alphabet::encode_table() const
+{
+    return m_encode;
+}
+
+const uint8_t* custom_alphabet::decode_table() const
+{
+    return m_decode;
+}
+}
+}
@@ -0,0 +1,59 @@
+// Copyright (c) Steinwurf ApS 2016.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "version.hpp"
+
+namespace aybabtu
+{
+inline namespace STEINWURF_AYBABTU_VERSION
+{
+/// A base64 alphabet of any 64 distinct ASCII characters other than '=' and
+/// whitespace, for instance the "./0-9A-Za-z" alphabet of crypt(3) or the
+/// alphabet of IMAP modified UTF-7, which uses ',' in place of '/'.
+///
+/// The lookup tables are built once, when the alphabet is constructed, and
+/// are used directly by both the bytewise code and the simd codecs. An
+/// alphabet is typically constructed once and reused, e.g. as a static.
+class custom_alphabet
+{
+public:
+    /// Check whether a string can be used as an alphabet.
+    /// @param characters the characters of the alphabet
+    /// @return true if characters holds exactly 64 distinct ASCII characters,
+    ///         none of which is the padding character '=' or whitespace,
+    ///         which whitespace::ignore removes before decoding
+    static bool is_valid(const std::string& characters);
+
+    /// Create an alphabet.
+    /// @param characters the characters of the alphabet, ordered by their
+    ///        6-bit value
+    /// @throws std::invalid_argument if the characters are not valid, see
+    ///         is_valid()
+    explicit custom_alphabet(const std::string& characters);
+
+    /// @return the characters of the alphabet, ordered by their 6-bit value
+    std::string characters() const;
+
+    /// @return a 64 entry table mapping every 6-bit value to its character
+    const uint8_t* encode_table() const;
+
+    /// @return a 256 entry table mapping every character to its 6-bit value,
+    ///         '=' to 254 and every other invalid character to 255
+    const uint8_t* decode_table() const;
+
+private:
+    /// The encode table
+    uint8_t m_encode[64];
+
+    /// The decode table
+    uint8_t m_decode[256];
+};
+}
+}
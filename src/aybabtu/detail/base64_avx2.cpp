@@ -7,6 +7,10 @@
 
 #include "base64_decode.hpp"
 #include "base64_encode.hpp"
+#include "base64_validate.hpp"
+#include "ssse3_loops.hpp"
+#include "strip_whitespace.hpp"
+#include "tables.hpp"
 
 #include <platform/config.hpp>
 
@@ -35,12 +39,16 @@ namespace detail
 // https://github.com/aklomp/base64 (published under BSD)
 // The code has been modified to fit the aybabtu library.
 
+template <alphabet Alphabet>
 static inline __m256i enc_translate(const __m256i in)
 {
     // A lookup table containing the absolute offsets for all ranges:
-    const __m256i lut = _mm256_setr_epi8(
-        65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0, 65, 71,
-        -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0);
+    const __m256i lut = _mm256_broadcastsi128_si256(
+        Alphabet == alphabet::url
+            ? _mm_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4,
+                            -17, 32, 0, 0)
+            : _mm_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4,
+                            -19, -16, 0, 0));
 
     // Translate values 0..63 to the Base64 alphabet. There are five sets:
     // #  From      To         Abs    Index  Characters
@@ -49,6 +57,8 @@ static inline __m256i enc_translate(const __m256i in)
     // 2  [52..61]  [48..57]    -4  [2..11]  0123456789
     // 3  [62]      [43]       -19       12  +
     // 4  [63]      [47]       -16       13  /
+    //
+    // The url alphabet maps range #3 to '-' (-17) and range #4 to '_' (+32).
 
     // Create LUT indices from the input. The index for range #0 is right,
     // others are 1 less than expected:
@@ -137,6 +147,7 @@ static inline __m256i enc_reshuffle(const __m256i input)
     // 00cccccc 00bbbbCC 00aaBBBB 00AAAAAA
 }
 
+template <alphabet Alphabet>
 static inline void encode_loop_avx2(const uint8_t** src, std::size_t& remaining,
                                     uint8_t** out, std::size_t& written)
 {
@@ -163,7 +174,7 @@ static inline void encode_loop_avx2(const uint8_t** src, std::size_t& remaining,
 
     // Reshuffle, translate, store:
     avx_src = enc_reshuffle(avx_src);
-    avx_src = enc_translate(avx_src);
+    avx_src = enc_translate<Alphabet>(avx_src);
     _mm256_storeu_si256((__m256i*)*out, avx_src);
 
     // Subsequent loads will be done at s - 4, set pointer for next round:
@@ -172,6 +183,51 @@ static inline void encode_loop_avx2(const uint8_t** src, std::size_t& remaining,
 
     rounds--;
 
+    // Encode four, and then two, blocks per round while enough remain, so
+    // that their independent chains overlap. The pointers are kept in locals,
+    // as the stores could otherwise alias them:
+    const uint8_t* in = *src;
+    uint8_t* it = *out;
+
+    while (rounds >= 4)
+    {
+        const __m256i a = _mm256_loadu_si256((__m256i*)in);
+        const __m256i b = _mm256_loadu_si256((__m256i*)(in + 24));
+        const __m256i c = _mm256_loadu_si256((__m256i*)(in + 48));
+        const __m256i d = _mm256_loadu_si256((__m256i*)(in + 72));
+
+        _mm256_storeu_si256((__m256i*)it,
+                            enc_translate<Alphabet>(enc_reshuffle(a)));
+        _mm256_storeu_si256((__m256i*)(it + 32),
+                            enc_translate<Alphabet>(enc_reshuffle(b)));
+        _mm256_storeu_si256((__m256i*)(it + 64),
+                            enc_translate<Alphabet>(enc_reshuffle(c)));
+        _mm256_storeu_si256((__m256i*)(it + 96),
+                            enc_translate<Alphabet>(enc_reshuffle(d)));
+
+        in += 96;
+        it += 128;
+        rounds -= 4;
+    }
+
+    while (rounds >= 2)
+    {
+        const __m256i a = _mm256_loadu_si256((__m256i*)in);
+        const __m256i b = _mm256_loadu_si256((__m256i*)(in + 24));
+
+        _mm256_storeu_si256((__m256i*)it,
+                            enc_translate<Alphabet>(enc_reshuffle(a)));
+        _mm256_storeu_si256((__m256i*)(it + 32),
+                            enc_translate<Alphabet>(enc_reshuffle(b)));
+
+        in += 48;
+        it += 64;
+        rounds -= 2;
+    }
+
+    *src = in;
+    *out = it;
+
     while (rounds > 0)
     {
         // Load input:
@@ -179,7 +235,7 @@ static inline void encode_loop_avx2(const uint8_t** src, std::size_t& remaining,
 
         // Reshuffle, translate, store:
         avx_src = enc_reshuffle(avx_src);
-        avx_src = enc_translate(avx_src);
+        avx_src = enc_translate<Alphabet>(avx_src);
         _mm256_storeu_si256((__m256i*)*out, avx_src);
 
         *src += 24;
@@ -229,6 +285,57 @@ static inline __m256i dec_reshuffle(const __m256i in)
         out, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, -1, -1));
 }
 
+// Look up the classes of the characters in str, see the SSSE3 decoder. The
+// result is not zero if str holds an invalid character.
+template <alphabet Alphabet>
+static inline __m256i dec_classify(const __m256i str)
+{
+    const __m256i mask_2F = _mm256_set1_epi8(0x2F);
+    const __m256i hi_nibbles =
+        _mm256_and_si256(_mm256_srli_epi32(str, 4), mask_2F);
+    const __m256i lo_nibbles = _mm256_and_si256(str, mask_2F);
+    const __m256i hi = _mm256_shuffle_epi8(
+        _mm256_broadcastsi128_si256(dec_lut_hi<Alphabet>()), hi_nibbles);
+    const __m256i lo = _mm256_shuffle_epi8(
+        _mm256_broadcastsi128_si256(dec_lut_lo<Alphabet>()), lo_nibbles);
+    return _mm256_and_si256(lo, hi);
+}
+
+// Returns true if str holds an invalid character.
+template <alphabet Alphabet>
+static inline bool dec_invalid(const __m256i str)
+{
+    const __m256i classes = dec_classify<Alphabet>(str);
+    return !_mm256_testz_si256(classes, classes);
+}
+
+// Translate the valid characters in str to their 6-bit values, see the
+// SSSE3 decoder.
+template <alphabet Alphabet>
+static inline __m256i dec_roll(const __m256i str)
+{
+    const __m256i lut_roll = _mm256_broadcastsi128_si256(
+        Alphabet == alphabet::url
+            ? _mm_setr_epi8(-32, 0, 17, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0,
+                            0, 0, 0)
+            : _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0,
+                            0, 0, 0));
+
+    const __m256i mask_2F = _mm256_set1_epi8(0x2F);
+    const __m256i mask_5F = _mm256_set1_epi8(0x5F);
+    const __m256i hi_nibbles =
+        _mm256_and_si256(_mm256_srli_epi32(str, 4), mask_2F);
+
+    const __m256i roll = _mm256_shuffle_epi8(
+        lut_roll,
+        Alphabet == alphabet::url
+            ? _mm256_subs_epu8(hi_nibbles, _mm256_cmpeq_epi8(str, mask_5F))
+            : _mm256_add_epi8(_mm256_cmpeq_epi8(str, mask_2F), hi_nibbles));
+
+    return _mm256_add_epi8(str, roll);
+}
+
+template <alphabet Alphabet>
 static inline void decode_loop_avx2(const uint8_t** src, std::size_t& remaining,
                                     uint8_t** out, std::size_t& written)
 {
@@ -243,72 +350,706 @@ static inline void decode_loop_avx2(const uint8_t** src, std::size_t& remaining,
     // two end-of-string markers.)
     size_t rounds = (remaining - 13) / 32;
 
-    const __m256i lut_lo = _mm256_setr_epi8(
-        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A,
-        0x1B, 0x1B, 0x1B, 0x1A, 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-        0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    // Decode four, and then two, blocks per round while enough remain, see
+    // decode_loop_ssse3. The classes of the blocks are "or"ed together, so
+    // that a single testz checks them all:
+    const uint8_t* in = *src;
+    uint8_t* it = *out;
 
-    const __m256i lut_hi = _mm256_setr_epi8(
-        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10,
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    while (rounds >= 4)
+    {
+        const __m256i a = _mm256_loadu_si256((__m256i*)in);
+        const __m256i b = _mm256_loadu_si256((__m256i*)(in + 32));
+        const __m256i c = _mm256_loadu_si256((__m256i*)(in + 64));
+        const __m256i d = _mm256_loadu_si256((__m256i*)(in + 96));
 
-    const __m256i lut_roll = _mm256_setr_epi8(
-        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 19, 4,
-        -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+        const __m256i classes =
+            _mm256_or_si256(_mm256_or_si256(dec_classify<Alphabet>(a),
+                                            dec_classify<Alphabet>(b)),
+                            _mm256_or_si256(dec_classify<Alphabet>(c),
+                                            dec_classify<Alphabet>(d)));
+        if (!_mm256_testz_si256(classes, classes))
+        {
+            break;
+        }
 
-    const __m256i mask_2F = _mm256_set1_epi8(0x2F);
+        _mm256_storeu_si256((__m256i*)it,
+                            dec_reshuffle(dec_roll<Alphabet>(a)));
+        _mm256_storeu_si256((__m256i*)(it + 24),
+                            dec_reshuffle(dec_roll<Alphabet>(b)));
+        _mm256_storeu_si256((__m256i*)(it + 48),
+                            dec_reshuffle(dec_roll<Alphabet>(c)));
+        _mm256_storeu_si256((__m256i*)(it + 72),
+                            dec_reshuffle(dec_roll<Alphabet>(d)));
 
-    while (rounds > 0)
+        in += 128;
+        it += 96;
+        rounds -= 4;
+    }
+
+    while (rounds >= 2)
     {
+        const __m256i a = _mm256_loadu_si256((__m256i*)in);
+        const __m256i b = _mm256_loadu_si256((__m256i*)(in + 32));
 
-        // Load input:
-        __m256i str = _mm256_loadu_si256((__m256i*)*src);
+        const __m256i classes = _mm256_or_si256(dec_classify<Alphabet>(a),
+                                                dec_classify<Alphabet>(b));
+        if (!_mm256_testz_si256(classes, classes))
+        {
+            break;
+        }
+
+        _mm256_storeu_si256((__m256i*)it,
+                            dec_reshuffle(dec_roll<Alphabet>(a)));
+        _mm256_storeu_si256((__m256i*)(it + 24),
+                            dec_reshuffle(dec_roll<Alphabet>(b)));
+
+        in += 64;
+        it += 48;
+        rounds -= 2;
+    }
 
-        // See the SSSE3 decoder for an explanation of the algorithm.
-        const __m256i hi_nibbles =
-            _mm256_and_si256(_mm256_srli_epi32(str, 4), mask_2F);
-        const __m256i lo_nibbles = _mm256_and_si256(str, mask_2F);
-        const __m256i hi = _mm256_shuffle_epi8(lut_hi, hi_nibbles);
-        const __m256i lo = _mm256_shuffle_epi8(lut_lo, lo_nibbles);
+    remaining -= in - *src;
+    written += it - *out;
+    *src = in;
+    *out = it;
 
-        if (!_mm256_testz_si256(lo, hi))
+    while (rounds > 0)
+    {
+        // Load input:
+        const __m256i str = _mm256_loadu_si256((__m256i*)*src);
+
+        // Check for invalid input, on invalid input fall back on bytewise
+        // code to do error checking and reporting:
+        if (dec_invalid<Alphabet>(str))
         {
-            continue;
+            break;
         }
 
+        // Translate, reshuffle the input to packed 12-byte output format and
+        // store the output:
+        _mm256_storeu_si256((__m256i*)*out,
+                            dec_reshuffle(dec_roll<Alphabet>(str)));
+
+        *src += 32;
+        *out += 24;
         remaining -= 32; // 32 bytes consumed per round
         written += 24;   // 24 bytes produced per round
+        rounds -= 1;
+    }
+}
+
+// See the SSSE3 codec for an explanation of the custom alphabet lookups. The
+// rows are broadcast to both 128-bit lanes.
+template <std::size_t Rows>
+static inline void load_rows(const uint8_t* table, __m256i* rows)
+{
+    __m128i previous = _mm_loadu_si128((const __m128i*)table);
+    rows[0] = _mm256_broadcastsi128_si256(previous);
+    for (std::size_t i = 1; i < Rows; ++i)
+    {
+        const __m128i row = _mm_loadu_si128((const __m128i*)table + i);
+        rows[i] = _mm256_broadcastsi128_si256(_mm_xor_si128(row, previous));
+        previous = row;
+    }
+}
+
+template <std::size_t Rows>
+static inline __m256i lookup_rows(const __m256i* rows, const __m256i in)
+{
+    __m256i result = _mm256_shuffle_epi8(rows[0], in);
+    for (std::size_t i = 1; i < Rows; ++i)
+    {
+        const __m256i mask =
+            _mm256_cmpgt_epi8(in, _mm256_set1_epi8(i * 16 - 1));
+        result = _mm256_xor_si256(
+            result, _mm256_and_si256(mask, _mm256_shuffle_epi8(rows[i], in)));
+    }
+    return result;
+}
+
+static inline void encode_loop_avx2_custom(const uint8_t** src,
+                                           std::size_t& remaining,
+                                           uint8_t** out, std::size_t& written,
+                                           const uint8_t* table)
+{
+    if (remaining < 32)
+    {
+        return;
+    }
+
+    // See encode_loop_avx2 for the bounds and the first round:
+    std::size_t rounds = (remaining - 4) / 24;
 
-        const __m256i eq_2F = _mm256_cmpeq_epi8(str, mask_2F);
-        const __m256i roll =
-            _mm256_shuffle_epi8(lut_roll, _mm256_add_epi8(eq_2F, hi_nibbles));
+    remaining -= rounds * 24; // 24 bytes consumed per round
+    written += rounds * 32;   // 32 bytes produced per round
+
+    __m256i rows[4];
+    load_rows<4>(table, rows);
 
-        // Now simply add the delta values to the input:
-        str = _mm256_add_epi8(str, roll);
+    // The first load is done at s - 0, and shifted into place:
+    __m256i str = _mm256_loadu_si256((__m256i*)*src);
+    str = _mm256_permutevar8x32_epi32(
+        str, _mm256_setr_epi32(0, 0, 1, 2, 3, 4, 5, 6));
+    str = enc_reshuffle(str);
+    str = lookup_rows<4>(rows, str);
+    _mm256_storeu_si256((__m256i*)*out, str);
 
-        // Reshuffle the input to packed 12-byte output format:
-        str = dec_reshuffle(str);
+    // Subsequent loads are done at s - 4:
+    *src += 20;
+    *out += 32;
+    rounds--;
 
-        // Store the output:
+    while (rounds > 0)
+    {
+        str = _mm256_loadu_si256((__m256i*)*src);
+        str = enc_reshuffle(str);
+        str = lookup_rows<4>(rows, str);
         _mm256_storeu_si256((__m256i*)*out, str);
 
+        *src += 24;
+        *out += 32;
+        rounds--;
+    }
+
+    // Add the offset back:
+    *src += 4;
+}
+
+static inline void decode_loop_avx2_custom(const uint8_t** src,
+                                           std::size_t& remaining,
+                                           uint8_t** out, std::size_t& written,
+                                           const uint8_t* table)
+{
+    if (remaining < 45)
+    {
+        return;
+    }
+
+    // See decode_loop_avx2 for the bounds:
+    size_t rounds = (remaining - 13) / 32;
+
+    __m256i rows[8];
+    load_rows<8>(table, rows);
+
+    while (rounds > 0)
+    {
+        const __m256i str = _mm256_loadu_si256((__m256i*)*src);
+        const __m256i values = lookup_rows<8>(rows, str);
+
+        // Invalid characters have the most significant bit set in values,
+        // non-ASCII characters in str. Fall back on bytewise code to do error
+        // checking and reporting:
+        if (_mm256_movemask_epi8(_mm256_or_si256(values, str)) != 0)
+        {
+            break;
+        }
+
+        _mm256_storeu_si256((__m256i*)*out, dec_reshuffle(values));
+
         *src += 32;
         *out += 24;
+        remaining -= 32; // 32 bytes consumed per round
+        written += 24;   // 24 bytes produced per round
         rounds -= 1;
     }
 }
 
+// The remainders that are too short for the AVX2 loops, e.g. the 44
+// characters of a 32-byte key, are handled by the SSSE3 loops and tails.
+template <alphabet Alphabet>
+static AYBABTU_FORCE_INLINE void encode_avx2(const uint8_t** src,
+                                             std::size_t& remaining,
+                                             uint8_t** out,
+                                             std::size_t& written)
+{
+    encode_loop_avx2<Alphabet>(src, remaining, out, written);
+    encode_ssse3<Alphabet>(src, remaining, out, written);
+}
+
+// Encode the whole groups at the start of a buffer from the back, see
+// encode_backward_ssse3. Every round loads the 32 bytes that start 4 bytes
+// before the last 24 bytes not yet encoded, as required by enc_reshuffle,
+// so there must be at least 4 bytes left in front of the block.
+template <class Translate>
+static inline void encode_backward_loop_avx2(Translate translate,
+                                             uint8_t* buffer,
+                                             std::size_t& remaining)
+{
+    while (remaining >= 28)
+    {
+        remaining -= 24;
+
+        __m256i str = _mm256_loadu_si256((__m256i*)(buffer + remaining - 4));
+        str = translate(enc_reshuffle(str));
+        _mm256_storeu_si256((__m256i*)(buffer + remaining / 3 * 4), str);
+    }
+}
+
+template <alphabet Alphabet>
+static inline void encode_backward_avx2(uint8_t* buffer,
+                                        std::size_t& remaining)
+{
+    encode_backward_loop_avx2([](const __m256i in)
+                              { return enc_translate<Alphabet>(in); },
+                              buffer, remaining);
+    encode_backward_ssse3<Alphabet>(buffer, remaining);
+}
+
+static inline void encode_backward_avx2_custom(uint8_t* buffer,
+                                               std::size_t& remaining,
+                                               const uint8_t* table)
+{
+    if (remaining >= 28)
+    {
+        __m256i rows[4];
+        load_rows<4>(table, rows);
+
+        encode_backward_loop_avx2([&rows](const __m256i in)
+                                  { return lookup_rows<4>(rows, in); },
+                                  buffer, remaining);
+    }
+    encode_backward_ssse3_custom(buffer, remaining, table);
+}
+
+template <alphabet Alphabet>
+static AYBABTU_FORCE_INLINE void decode_avx2(const uint8_t** src,
+                                             std::size_t& remaining,
+                                             uint8_t** out,
+                                             std::size_t& written)
+{
+    decode_loop_avx2<Alphabet>(src, remaining, out, written);
+    decode_ssse3<Alphabet>(src, remaining, out, written);
+}
+
+static inline void encode_avx2_custom(const uint8_t** src,
+                                      std::size_t& remaining, uint8_t** out,
+                                      std::size_t& written,
+                                      const uint8_t* table)
+{
+    encode_loop_avx2_custom(src, remaining, out, written, table);
+    encode_ssse3_custom(src, remaining, out, written, table);
+}
+
+static inline void decode_avx2_custom(const uint8_t** src,
+                                      std::size_t& remaining, uint8_t** out,
+                                      std::size_t& written,
+                                      const uint8_t* table)
+{
+    decode_loop_avx2_custom(src, remaining, out, written, table);
+    decode_ssse3_custom(src, remaining, out, written, table);
+}
+
+// Check the characters 32 at a time, see validate_ssse3. Strings shorter
+// than 32 bytes are left to the SSSE3 code.
+template <class Invalid>
+static inline bool validate_loop_avx2(Invalid invalid, const uint8_t** src,
+                                      std::size_t& remaining)
+{
+    const uint8_t* it = *src;
+    const uint8_t* end = *src + remaining;
+
+    for (; end - it >= 32; it += 32)
+    {
+        if (invalid(_mm256_loadu_si256((__m256i*)it)))
+        {
+            return false;
+        }
+    }
+
+    if (it != end && invalid(_mm256_loadu_si256((__m256i*)(end - 32))))
+    {
+        return false;
+    }
+
+    *src = end;
+    remaining = 0;
+    return true;
+}
+
+template <alphabet Alphabet>
+static inline bool validate_avx2(const uint8_t** src, std::size_t& remaining)
+{
+    if (remaining < 32)
+    {
+        return validate_ssse3<Alphabet>(src, remaining);
+    }
+
+    return validate_loop_avx2([](const __m256i str)
+                              { return dec_invalid<Alphabet>(str); },
+                              src, remaining);
+}
+
+// Custom alphabets are classified as in decode_loop_avx2_custom.
+static inline bool validate_avx2_custom(const uint8_t** src,
+                                        std::size_t& remaining,
+                                        const uint8_t* table)
+{
+    if (remaining < 32)
+    {
+        return validate_ssse3_custom(src, remaining, table);
+    }
+
+    __m256i rows[8];
+    load_rows<8>(table, rows);
+
+    return validate_loop_avx2(
+        [&rows](const __m256i str)
+        {
+            const __m256i values = lookup_rows<8>(rows, str);
+            return _mm256_movemask_epi8(_mm256_or_si256(values, str)) != 0;
+        },
+        src, remaining);
+}
+
+// Whitespace is stripped 32 bytes at a time. Blocks without whitespace are
+// stored as they are. In line-wrapped input a block holds at most a line
+// break, so the runs of characters between its few whitespace bytes are moved
+// with a vector load and store each. Blocks with more whitespace are packed
+// 8 bytes at a time with pshufb, see the SSSE3 codec.
+
+static inline uint32_t keep_mask(const __m256i str)
+{
+    // Whitespace is ' ' or one of the control characters from '\t' to '\r':
+    const __m256i offset = _mm256_sub_epi8(str, _mm256_set1_epi8('\t'));
+    const __m256i control = _mm256_cmpeq_epi8(
+        _mm256_min_epu8(offset, _mm256_set1_epi8(4)), offset);
+    const __m256i space = _mm256_cmpeq_epi8(str, _mm256_set1_epi8(' '));
+
+    return ~(uint32_t)_mm256_movemask_epi8(_mm256_or_si256(control, space));
+}
+
+static inline uint32_t trailing_zeros(uint32_t x)
+{
+#if defined(PLATFORM_MSVC_X86)
+    unsigned long index;
+    _BitScanForward(&index, x);
+    return index;
+#else
+    return __builtin_ctz(x);
+#endif
+}
+
+static inline std::size_t popcount8(uint32_t x)
+{
+    x = x - ((x >> 1) & 0x55);
+    x = (x & 0x33) + ((x >> 2) & 0x33);
+    return (x + (x >> 4)) & 0x0F;
+}
+
+// Pack the bytes selected by keep to the front of out. Always writes 16
+// bytes, but only the returned number of bytes are valid.
+static inline std::size_t compress(const __m128i str, uint32_t keep,
+                                   uint8_t* out)
+{
+    const uint32_t lo = keep & 0xFF;
+    const uint32_t hi = (keep >> 8) & 0xFF;
+
+    // The indices of the upper half are offset by 8:
+    const __m128i shuffle = _mm_add_epi8(
+        _mm_unpacklo_epi64(
+            _mm_loadl_epi64((const __m128i*)(tables::compress + lo * 8)),
+            _mm_loadl_epi64((const __m128i*)(tables::compress + hi * 8))),
+        _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8));
+
+    const __m128i packed = _mm_shuffle_epi8(str, shuffle);
+    const std::size_t lo_count = popcount8(lo);
+
+    _mm_storel_epi64((__m128i*)out, packed);
+    _mm_storel_epi64((__m128i*)(out + lo_count), _mm_srli_si128(packed, 8));
+
+    return lo_count + popcount8(hi);
+}
+
+static inline void strip_loop_avx2(const uint8_t** src, std::size_t& remaining,
+                                   uint8_t** out, std::size_t& written)
+{
+    // The output never gets ahead of the input, so the 32 bytes written per
+    // round stay within the size of the input:
+    while (remaining >= 32)
+    {
+        const __m256i str = _mm256_loadu_si256((__m256i*)*src);
+        const uint32_t keep = keep_mask(str);
+        uint32_t space = ~keep;
+
+        // The whitespace beyond the first four bytes of it:
+        uint32_t dense = space & (space - 1);
+        dense &= dense - 1;
+        dense &= dense - 1;
+        dense &= dense - 1;
+
+        std::size_t count = 32;
+        if (keep == 0xFFFFFFFF)
+        {
+            _mm256_storeu_si256((__m256i*)*out, str);
+        }
+        else if (dense == 0 && remaining >= 64)
+        {
+            // The loads of the runs reach up to 31 bytes past the block:
+            const uint8_t* run = *src;
+            uint8_t* it = *out;
+            while (true)
+            {
+                const uint8_t* end =
+                    space == 0 ? *src + 32 : *src + trailing_zeros(space);
+                _mm256_storeu_si256((__m256i*)it,
+                                    _mm256_loadu_si256((__m256i*)run));
+                it += end - run;
+                if (space == 0)
+                {
+                    break;
+                }
+                run = end + 1;
+                space &= space - 1;
+            }
+            count = it - *out;
+        }
+        else
+        {
+            count = compress(_mm256_castsi256_si128(str), keep, *out);
+            count += compress(_mm256_extracti128_si256(str, 1), keep >> 16,
+                              *out + count);
+        }
+
+        *src += 32;
+        *out += count;
+        remaining -= 32;
+        written += count;
+    }
+}
+
+// The streaming loops, see the SSSE3 codec. The decoder packs the 24 bytes
+// of four blocks into three whole vectors, and the rest is left to the
+// normal AVX2 and SSSE3 loops.
+
+template <alphabet Alphabet>
+static inline void encode_stream_avx2(const uint8_t** src,
+                                      std::size_t& remaining, uint8_t** out,
+                                      std::size_t& written)
+{
+    if (remaining >= 128 &&
+        encode_align(Alphabet == alphabet::url ? tables::encode_url
+                                               : tables::encode,
+                     src, remaining, out, written, 32))
+    {
+        // Every block is loaded at its start and shifted by 4 bytes, as
+        // required by enc_reshuffle, like the first block of
+        // encode_loop_avx2:
+        const __m256i shift = _mm256_setr_epi32(0, 0, 1, 2, 3, 4, 5, 6);
+
+        while (remaining >= 32)
+        {
+            __m256i str = _mm256_loadu_si256((__m256i*)*src);
+            str = _mm256_permutevar8x32_epi32(str, shift);
+            str = enc_translate<Alphabet>(enc_reshuffle(str));
+            _mm256_stream_si256((__m256i*)*out, str);
+
+            *src += 24;
+            *out += 32;
+            remaining -= 24;
+            written += 32;
+        }
+        _mm_sfence();
+    }
+    encode_avx2<Alphabet>(src, remaining, out, written);
+}
+
+template <alphabet Alphabet>
+static inline void decode_stream_avx2(const uint8_t** src,
+                                      std::size_t& remaining, uint8_t** out,
+                                      std::size_t& written)
+{
+    if (remaining >= 256 &&
+        decode_align(Alphabet == alphabet::url ? tables::decode_shifted_url
+                                               : tables::decode_shifted,
+                     src, remaining, out, written, 32))
+    {
+        while (remaining >= 128)
+        {
+            __m256i a = _mm256_loadu_si256((__m256i*)*src);
+            __m256i b = _mm256_loadu_si256((__m256i*)(*src + 32));
+            __m256i c = _mm256_loadu_si256((__m256i*)(*src + 64));
+            __m256i d = _mm256_loadu_si256((__m256i*)(*src + 96));
+
+            // Leave invalid input to the normal loops:
+            const __m256i classes =
+                _mm256_or_si256(_mm256_or_si256(dec_classify<Alphabet>(a),
+                                                dec_classify<Alphabet>(b)),
+                                _mm256_or_si256(dec_classify<Alphabet>(c),
+                                                dec_classify<Alphabet>(d)));
+            if (!_mm256_testz_si256(classes, classes))
+            {
+                break;
+            }
+
+            // Every reshuffled block holds its 24 bytes in the lower six
+            // 32-bit words, which are moved into place and blended:
+            a = dec_reshuffle(dec_roll<Alphabet>(a));
+            b = dec_reshuffle(dec_roll<Alphabet>(b));
+            c = dec_reshuffle(dec_roll<Alphabet>(c));
+            d = dec_reshuffle(dec_roll<Alphabet>(d));
+
+            const __m256i v0 = _mm256_blend_epi32(
+                a,
+                _mm256_permutevar8x32_epi32(
+                    b, _mm256_setr_epi32(0, 0, 0, 0, 0, 0, 0, 1)),
+                0xC0);
+            const __m256i v1 = _mm256_blend_epi32(
+                _mm256_permutevar8x32_epi32(
+                    b, _mm256_setr_epi32(2, 3, 4, 5, 0, 0, 0, 0)),
+                _mm256_permutevar8x32_epi32(
+                    c, _mm256_setr_epi32(0, 0, 0, 0, 0, 1, 2, 3)),
+                0xF0);
+            const __m256i v2 = _mm256_blend_epi32(
+                _mm256_permutevar8x32_epi32(
+                    c, _mm256_setr_epi32(4, 5, 0, 0, 0, 0, 0, 0)),
+                _mm256_permutevar8x32_epi32(
+                    d, _mm256_setr_epi32(0, 0, 0, 1, 2, 3, 4, 5)),
+                0xFC);
+
+            _mm256_stream_si256((__m256i*)*out, v0);
+            _mm256_stream_si256((__m256i*)(*out + 32), v1);
+            _mm256_stream_si256((__m256i*)(*out + 64), v2);
+
+            *src += 128;
+            *out += 96;
+            remaining -= 128;
+            written += 96;
+        }
+        _mm_sfence();
+    }
+    decode_avx2<Alphabet>(src, remaining, out, written);
+}
+
 std::size_t base64_avx2::encode(const uint8_t* src, std::size_t size,
                                 uint8_t* out)
 {
-    return base64_encode(&encode_loop_avx2, src, size, out);
+    return base64_encode<alphabet::standard>(
+        &encode_avx2<alphabet::standard>, src, size, out);
 }
 
 std::size_t base64_avx2::decode(const uint8_t* src, std::size_t size,
                                 uint8_t* out, std::error_code& error)
 {
-    return base64_decode(&decode_loop_avx2, src, size, out, error);
+    return base64_decode<alphabet::standard>(
+        &decode_avx2<alphabet::standard>, src, size, out, error);
+}
+
+std::size_t base64_avx2::encode_url(const uint8_t* src, std::size_t size,
+                                    uint8_t* out)
+{
+    return base64_encode<alphabet::url>(
+        &encode_avx2<alphabet::url>, src, size, out);
+}
+
+std::size_t base64_avx2::decode_url(const uint8_t* src, std::size_t size,
+                                    uint8_t* out, std::error_code& error)
+{
+    return base64_decode<alphabet::url>(
+        &decode_avx2<alphabet::url>, src, size, out, error);
+}
+
+std::size_t base64_avx2::encode_custom(const uint8_t* src, std::size_t size,
+                                       uint8_t* out, const uint8_t* table)
+{
+    return base64_encode(
+        [table](const uint8_t** src_it, std::size_t& remaining,
+                uint8_t** out_it, std::size_t& written)
+        {
+            encode_avx2_custom(src_it, remaining, out_it, written, table);
+        },
+        table, src, size, out);
+}
+
+std::size_t base64_avx2::decode_custom(const uint8_t* src, std::size_t size,
+                                       uint8_t* out, const uint8_t* table,
+                                       std::error_code& error)
+{
+    return base64_decode(
+        [table](const uint8_t** src_it, std::size_t& remaining,
+                uint8_t** out_it, std::size_t& written)
+        {
+            decode_avx2_custom(src_it, remaining, out_it, written, table);
+        },
+        table, src, size, out, error);
+}
+
+bool base64_avx2::validate(const uint8_t* src, std::size_t size)
+{
+    return base64_validate(&validate_avx2<alphabet::standard>, tables::decode,
+                           src, size);
+}
+
+bool base64_avx2::validate_url(const uint8_t* src, std::size_t size)
+{
+    return base64_validate(&validate_avx2<alphabet::url>, tables::decode_url,
+                           src, size);
+}
+
+bool base64_avx2::validate_custom(const uint8_t* src, std::size_t size,
+                                  const uint8_t* table)
+{
+    return base64_validate(
+        [table](const uint8_t** src, std::size_t& remaining)
+        { return validate_avx2_custom(src, remaining, table); },
+        table, src, size);
+}
+
+std::size_t base64_avx2::encode_inplace(uint8_t* buffer, std::size_t size)
+{
+    return base64_encode_backward(&encode_backward_avx2<alphabet::standard>,
+                                  tables::encode, buffer, size);
+}
+
+std::size_t base64_avx2::encode_inplace_url(uint8_t* buffer, std::size_t size)
+{
+    return base64_encode_backward(&encode_backward_avx2<alphabet::url>,
+                                  tables::encode_url, buffer, size);
+}
+
+std::size_t base64_avx2::encode_inplace_custom(uint8_t* buffer,
+                                               std::size_t size,
+                                               const uint8_t* table)
+{
+    return base64_encode_backward(
+        [table](uint8_t* buffer, std::size_t& remaining)
+        { encode_backward_avx2_custom(buffer, remaining, table); },
+        table, buffer, size);
+}
+
+std::size_t base64_avx2::encode_stream(const uint8_t* src, std::size_t size,
+                                       uint8_t* out)
+{
+    return base64_encode<alphabet::standard>(
+        &encode_stream_avx2<alphabet::standard>, src, size, out);
+}
+
+std::size_t base64_avx2::decode_stream(const uint8_t* src, std::size_t size,
+                                       uint8_t* out, std::error_code& error)
+{
+    return base64_decode<alphabet::standard>(
+        &decode_stream_avx2<alphabet::standard>, src, size, out, error);
+}
+
+std::size_t base64_avx2::encode_stream_url(const uint8_t* src,
+                                           std::size_t size, uint8_t* out)
+{
+    return base64_encode<alphabet::url>(&encode_stream_avx2<alphabet::url>,
+                                        src, size, out);
+}
+
+std::size_t base64_avx2::decode_stream_url(const uint8_t* src,
+                                           std::size_t size, uint8_t* out,
+                                           std::error_code& error)
+{
+    return base64_decode<alphabet::url>(&decode_stream_avx2<alphabet::url>,
+                                        src, size, out, error);
+}
+
+std::size_t base64_avx2::strip_whitespace(const uint8_t* src, std::size_t size,
+                                          uint8_t* out)
+{
+    return detail::strip_whitespace(&strip_loop_avx2, src, size, out);
 }
 
 bool base64_avx2::is_compiled()
@@ -331,6 +1072,119 @@ std::size_t base64_avx2::decode(const uint8_t*, std::size_t, uint8_t*,
     return 0;
 }
 
+std::size_t base64_avx2::encode_url(const uint8_t*, std::size_t, uint8_t*)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_avx2::decode_url(const uint8_t*, std::size_t, uint8_t*,
+                                    std::error_code&)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_avx2::encode_custom(const uint8_t*, std::size_t, uint8_t*,
+                                       const uint8_t*)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_avx2::decode_custom(const uint8_t*, std::size_t, uint8_t*,
+                                       const uint8_t*, std::error_code&)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+bool base64_avx2::validate(const uint8_t*, std::size_t)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return false;
+}
+
+bool base64_avx2::validate_url(const uint8_t*, std::size_t)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return false;
+}
+
+bool base64_avx2::validate_custom(const uint8_t*, std::size_t, const uint8_t*)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return false;
+}
+
+std::size_t base64_avx2::encode_inplace(uint8_t*, std::size_t)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_avx2::encode_inplace_url(uint8_t*, std::size_t)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_avx2::encode_inplace_custom(uint8_t*, std::size_t,
+                                               const uint8_t*)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_avx2::encode_stream(const uint8_t*, std::size_t, uint8_t*)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_avx2::decode_stream(const uint8_t*, std::size_t, uint8_t*,
+                                       std::error_code&)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_avx2::encode_stream_url(const uint8_t*, std::size_t,
+                                           uint8_t*)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_avx2::decode_stream_url(const uint8_t*, std::size_t,
+                                           uint8_t*, std::error_code&)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_avx2::strip_whitespace(const uint8_t*, std::size_t,
+                                          uint8_t*)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
 bool base64_avx2::is_compiled()
 {
     return false;
@@ -18,12 +18,92 @@ namespace detail
 {
 struct base64_avx2
 {
+    /// Encode with the standard alphabet, without padding
     static std::size_t encode(const uint8_t* src, std::size_t size,
                               uint8_t* out);
 
+    /// Decode with the standard alphabet, without padding
     static std::size_t decode(const uint8_t* src, std::size_t size,
                               uint8_t* out, std::error_code& error);
 
+    /// Encode with the URL and filename safe alphabet, without padding
+    static std::size_t encode_url(const uint8_t* src, std::size_t size,
+                                  uint8_t* out);
+
+    /// Decode with the URL and filename safe alphabet, without padding
+    static std::size_t decode_url(const uint8_t* src, std::size_t size,
+                                  uint8_t* out, std::error_code& error);
+
+    /// Encode with a custom alphabet, without padding
+    static std::size_t encode_custom(const uint8_t* src, std::size_t size,
+                                     uint8_t* out, const uint8_t* table);
+
+    /// Decode with a custom alphabet, without padding
+    static std::size_t decode_custom(const uint8_t* src, std::size_t size,
+                                     uint8_t* out, const uint8_t* table,
+                                     std::error_code& error);
+
+    /// Check a string with the standard alphabet, without padding
+    /// @return true if the string can be decoded
+    static bool validate(const uint8_t* src, std::size_t size);
+
+    /// Check a string with the URL and filename safe alphabet, without
+    /// padding
+    /// @return true if the string can be decoded
+    static bool validate_url(const uint8_t* src, std::size_t size);
+
+    /// Check a string with a custom alphabet, without padding
+    /// @return true if the string can be decoded
+    static bool validate_custom(const uint8_t* src, std::size_t size,
+                                const uint8_t* table);
+
+    /// Encode the data at the start of a buffer into the same buffer with
+    /// the standard alphabet, without padding
+    /// @return the number of characters written to the buffer
+    static std::size_t encode_inplace(uint8_t* buffer, std::size_t size);
+
+    /// Encode the data at the start of a buffer into the same buffer with
+    /// the URL and filename safe alphabet, without padding
+    /// @return the number of characters written to the buffer
+    static std::size_t encode_inplace_url(uint8_t* buffer, std::size_t size);
+
+    /// Encode the data at the start of a buffer into the same buffer with a
+    /// custom alphabet, without padding
+    /// @return the number of characters written to the buffer
+    static std::size_t encode_inplace_custom(uint8_t* buffer,
+                                             std::size_t size,
+                                             const uint8_t* table);
+
+    /// Encode with the standard alphabet, writing the output with
+    /// non-temporal stores that bypass the caches
+    /// @return the number of characters written to out
+    static std::size_t encode_stream(const uint8_t* src, std::size_t size,
+                                     uint8_t* out);
+
+    /// Decode with the standard alphabet, writing the output with
+    /// non-temporal stores that bypass the caches
+    /// @return the number of bytes written to out
+    static std::size_t decode_stream(const uint8_t* src, std::size_t size,
+                                     uint8_t* out, std::error_code& error);
+
+    /// Encode with the URL and filename safe alphabet, writing the output
+    /// with non-temporal stores that bypass the caches
+    /// @return the number of characters written to out
+    static std::size_t encode_stream_url(const uint8_t* src,
+                                         std::size_t size, uint8_t* out);
+
+    /// Decode with the URL and filename safe alphabet, writing the output
+    /// with non-temporal stores that bypass the caches
+    /// @return the number of bytes written to out
+    static std::size_t decode_stream_url(const uint8_t* src,
+                                         std::size_t size, uint8_t* out,
+                                         std::error_code& error);
+
+    /// Copy src to out without the ASCII whitespace
+    /// @return the number of bytes written to out, at most size
+    static std::size_t strip_whitespace(const uint8_t* src, std::size_t size,
+                                        uint8_t* out);
+
     /// @return whether this cpu acceralation is compiled or not
     static bool is_compiled();
 };
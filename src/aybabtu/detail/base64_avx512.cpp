@@ -0,0 +1,566 @@
+// Copyright (c) Steinwurf ApS 2016.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include "base64_avx512.hpp"
+
+#include "base64_decode.hpp"
+#include "base64_encode.hpp"
+#include "tables.hpp"
+
+#include <platform/config.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <system_error>
+
+#include "../version.hpp"
+
+// Include x86 intrinsics for GCC-compatible compilers on x86/x86_64
+#if defined(PLATFORM_GCC_COMPATIBLE_X86)
+#include <x86intrin.h>
+#elif defined(PLATFORM_MSVC_X86)
+#include <immintrin.h>
+#endif
+
+namespace aybabtu
+{
+inline namespace STEINWURF_AYBABTU_VERSION
+{
+namespace detail
+{
+#if defined(PLATFORM_GCC_COMPATIBLE_X86) && defined(__AVX512VBMI__) && \
+    defined(__AVX512BW__)
+
+// This code is based on the AVX-512 VBMI algorithm described by Wojciech Muła
+// and Daniel Lemire in "Base64 encoding and decoding at almost the speed of a
+// memory copy" (Software: Practice and Experience, 2020).
+//
+// The translation is a plain table lookup, so the same loops serve every
+// alphabet, including custom ones. The partial blocks at the end of the input
+// are loaded and stored with the AVX-512 mask registers.
+
+static inline __mmask64 byte_mask(std::size_t bytes)
+{
+    assert(bytes > 0 && bytes <= 64);
+    return (__mmask64)(~uint64_t(0) >> (64 - bytes));
+}
+
+static inline void encode_loop_avx512_custom(const uint8_t** src,
+                                             std::size_t& remaining,
+                                             uint8_t** out,
+                                             std::size_t& written,
+                                             const uint8_t* table)
+{
+    if (remaining < 3)
+    {
+        return;
+    }
+
+    // Duplicate the middle byte of every 3-byte group, so that each 32-bit
+    // word holds the bytes [b1, b0, b2, b1]:
+    const __m512i shuffle_input = _mm512_setr_epi32(
+        0x01020001, 0x04050304, 0x07080607, 0x0a0b090a, 0x0d0e0c0d,
+        0x10110f10, 0x13141213, 0x16171516, 0x191a1819, 0x1c1d1b1c,
+        0x1f201e1f, 0x22232122, 0x25262425, 0x28292728, 0x2b2c2a2b,
+        0x2e2f2d2e);
+
+    // The bit offsets of the four 6-bit fields in each 32-bit word, in
+    // output order. vpmultishiftqb extracts an unaligned byte at each
+    // offset; only the lower 6 bits are used by the lookup below:
+    const __m512i shifts = _mm512_set1_epi64(0x3036242a1016040a);
+
+    // The 64 character alphabet fits exactly in one register:
+    const __m512i lut = _mm512_loadu_si512((const void*)table);
+
+    if (remaining >= 64)
+    {
+        // Process blocks of 48 bytes at a time. Because blocks are loaded 64
+        // bytes at a time, ensure that there will be at least 16 remaining
+        // bytes after the last round, so that the final read will not pass
+        // beyond the bounds of the input buffer:
+        std::size_t rounds = (remaining - 16) / 48;
+
+        remaining -= rounds * 48; // 48 bytes consumed per round
+        written += rounds * 64;   // 64 bytes produced per round
+
+        while (rounds > 0)
+        {
+            // Load input:
+            __m512i str = _mm512_loadu_si512((const void*)*src);
+
+            // Reshuffle, extract the 6-bit indices, translate, store:
+            str = _mm512_permutexvar_epi8(shuffle_input, str);
+            str = _mm512_multishift_epi64_epi8(shifts, str);
+            str = _mm512_permutexvar_epi8(str, lut);
+            _mm512_storeu_si512((void*)*out, str);
+
+            *src += 48;
+            *out += 64;
+            rounds--;
+        }
+    }
+
+    // Encode the remaining whole 3-byte groups with masked loads and stores.
+    // The bytes outside the mask are never touched:
+    while (remaining >= 3)
+    {
+        const std::size_t bytes = std::min<std::size_t>(remaining / 3 * 3, 48);
+        const std::size_t chars = bytes / 3 * 4;
+
+        __m512i str = _mm512_maskz_loadu_epi8(byte_mask(bytes), *src);
+        str = _mm512_permutexvar_epi8(shuffle_input, str);
+        str = _mm512_multishift_epi64_epi8(shifts, str);
+        str = _mm512_permutexvar_epi8(str, lut);
+        _mm512_mask_storeu_epi8(*out, byte_mask(chars), str);
+
+        *src += bytes;
+        *out += chars;
+        remaining -= bytes;
+        written += chars;
+    }
+}
+
+static inline void decode_loop_avx512_custom(const uint8_t** src,
+                                             std::size_t& remaining,
+                                             uint8_t** out,
+                                             std::size_t& written,
+                                             const uint8_t* table)
+{
+    if (remaining < 4)
+    {
+        return;
+    }
+
+    // The decode table maps every ASCII character to its 6-bit value, and
+    // every invalid character (including '=') to a value with the most
+    // significant bit set. The first 128 entries fit in two registers:
+    const __m512i lut_lo = _mm512_loadu_si512((const void*)table);
+    const __m512i lut_hi = _mm512_loadu_si512((const void*)(table + 64));
+
+    // Gather the three output bytes of every 32-bit word into 48 packed
+    // bytes:
+    const __m512i pack = _mm512_setr_epi32(
+        0x06000102, 0x090a0405, 0x0c0d0e08, 0x16101112, 0x191a1415,
+        0x1c1d1e18, 0x26202122, 0x292a2425, 0x2c2d2e28, 0x36303132,
+        0x393a3435, 0x3c3d3e38, 0x00000000, 0x00000000, 0x00000000,
+        0x00000000);
+
+    if (remaining >= 88)
+    {
+        // Process blocks of 64 bytes per round. Every round stores 16 bytes
+        // of scratch after its 48 output bytes, which the next round
+        // overwrites, so do not rely on their value. Ensure that there will
+        // be at least 24 bytes of input data left to cover the gap. (22 data
+        // bytes and up to two end-of-string markers.)
+        std::size_t rounds = (remaining - 24) / 64;
+
+        while (rounds > 0)
+        {
+            // Load input:
+            const __m512i str = _mm512_loadu_si512((const void*)*src);
+
+            // Translate the lower 7 bits of every byte through the 128 byte
+            // table:
+            const __m512i values =
+                _mm512_permutex2var_epi8(lut_lo, str, lut_hi);
+
+            // Non-ASCII input has the most significant bit set in str,
+            // invalid ASCII input has it set in values. If any are found fall
+            // back on bytewise code to do error checking and reporting:
+            if (_mm512_movepi8_mask(_mm512_or_si512(values, str)) != 0)
+            {
+                return;
+            }
+
+            // See the SSSE3 decoder for an explanation of the packing:
+            const __m512i merge_ab_and_bc =
+                _mm512_maddubs_epi16(values, _mm512_set1_epi32(0x01400140));
+            const __m512i merged = _mm512_madd_epi16(
+                merge_ab_and_bc, _mm512_set1_epi32(0x00011000));
+
+            // Store the output:
+            _mm512_storeu_si512((void*)*out,
+                                _mm512_permutexvar_epi8(pack, merged));
+
+            *src += 64;
+            *out += 48;
+            remaining -= 64; // 64 bytes consumed per round
+            written += 48;   // 48 bytes produced per round
+            rounds -= 1;
+        }
+    }
+
+    // Decode the remaining whole 4-character groups with masked loads and
+    // stores:
+    while (remaining >= 4)
+    {
+        const std::size_t chars = std::min<std::size_t>(remaining / 4 * 4, 64);
+        const std::size_t bytes = chars / 4 * 3;
+        const __mmask64 mask = byte_mask(chars);
+
+        const __m512i str = _mm512_maskz_loadu_epi8(mask, *src);
+        const __m512i values = _mm512_permutex2var_epi8(lut_lo, str, lut_hi);
+
+        if ((_mm512_movepi8_mask(_mm512_or_si512(values, str)) & mask) != 0)
+        {
+            return;
+        }
+
+        const __m512i merge_ab_and_bc =
+            _mm512_maddubs_epi16(values, _mm512_set1_epi32(0x01400140));
+        const __m512i merged =
+            _mm512_madd_epi16(merge_ab_and_bc, _mm512_set1_epi32(0x00011000));
+        _mm512_mask_storeu_epi8(*out, byte_mask(bytes),
+                                _mm512_permutexvar_epi8(pack, merged));
+
+        *src += chars;
+        *out += bytes;
+        remaining -= chars;
+        written += bytes;
+    }
+}
+
+// The streaming loops write the output with non-temporal stores, see the
+// SSSE3 codec. The output is aligned to 64 bytes a group at a time, and the
+// rest is left to the normal loops.
+static inline void encode_stream_avx512(const uint8_t** src,
+                                        std::size_t& remaining, uint8_t** out,
+                                        std::size_t& written,
+                                        const uint8_t* table)
+{
+    if (remaining >= 256 &&
+        encode_align(table, src, remaining, out, written, 64))
+    {
+        // See encode_loop_avx512_custom:
+        const __m512i shuffle_input = _mm512_setr_epi32(
+            0x01020001, 0x04050304, 0x07080607, 0x0a0b090a, 0x0d0e0c0d,
+            0x10110f10, 0x13141213, 0x16171516, 0x191a1819, 0x1c1d1b1c,
+            0x1f201e1f, 0x22232122, 0x25262425, 0x28292728, 0x2b2c2a2b,
+            0x2e2f2d2e);
+        const __m512i shifts = _mm512_set1_epi64(0x3036242a1016040a);
+        const __m512i lut = _mm512_loadu_si512((const void*)table);
+
+        while (remaining >= 64)
+        {
+            __m512i str = _mm512_loadu_si512((const void*)*src);
+            str = _mm512_permutexvar_epi8(shuffle_input, str);
+            str = _mm512_multishift_epi64_epi8(shifts, str);
+            str = _mm512_permutexvar_epi8(str, lut);
+            _mm512_stream_si512((__m512i*)*out, str);
+
+            *src += 48;
+            *out += 64;
+            remaining -= 48;
+            written += 64;
+        }
+        _mm_sfence();
+    }
+    encode_loop_avx512_custom(src, remaining, out, written, table);
+}
+
+// Four blocks of 64 characters decode to 192 bytes, which are stored as
+// three whole vectors. Every vector gathers its bytes from the merged 32-bit
+// words of two neighbouring blocks with a single two-source permute.
+static inline void decode_stream_avx512(const uint8_t** src,
+                                        std::size_t& remaining, uint8_t** out,
+                                        std::size_t& written,
+                                        const uint8_t* table,
+                                        const uint32_t* shifted)
+{
+    if (remaining >= 512 &&
+        decode_align(shifted, src, remaining, out, written, 64))
+    {
+        const __m512i lut_lo = _mm512_loadu_si512((const void*)table);
+        const __m512i lut_hi = _mm512_loadu_si512((const void*)(table + 64));
+
+        // Output byte k of the 192 comes from block k / 48, where the three
+        // bytes of group g are bytes 2, 1 and 0 of its 32-bit word. Vector v
+        // permutes blocks v and v + 1, which are the indices 0-63 and 64-127:
+        uint8_t indices[192];
+        for (std::size_t k = 0; k < sizeof(indices); ++k)
+        {
+            const std::size_t block = k / 48;
+            const std::size_t j = k % 48;
+            indices[k] =
+                (uint8_t)(64 * (block - k / 64) + 4 * (j / 3) + 2 - j % 3);
+        }
+        const __m512i pack0 = _mm512_loadu_si512((const void*)indices);
+        const __m512i pack1 = _mm512_loadu_si512((const void*)(indices + 64));
+        const __m512i pack2 =
+            _mm512_loadu_si512((const void*)(indices + 128));
+
+        const __m512i merge_ab_and_bc = _mm512_set1_epi32(0x01400140);
+        const __m512i merge_abc = _mm512_set1_epi32(0x00011000);
+
+        while (remaining >= 256)
+        {
+            const __m512i a = _mm512_loadu_si512((const void*)*src);
+            const __m512i b = _mm512_loadu_si512((const void*)(*src + 64));
+            const __m512i c = _mm512_loadu_si512((const void*)(*src + 128));
+            const __m512i d = _mm512_loadu_si512((const void*)(*src + 192));
+
+            const __m512i va = _mm512_permutex2var_epi8(lut_lo, a, lut_hi);
+            const __m512i vb = _mm512_permutex2var_epi8(lut_lo, b, lut_hi);
+            const __m512i vc = _mm512_permutex2var_epi8(lut_lo, c, lut_hi);
+            const __m512i vd = _mm512_permutex2var_epi8(lut_lo, d, lut_hi);
+
+            // Leave invalid input to the normal loop, see
+            // decode_loop_avx512_custom:
+            const __m512i check = _mm512_or_si512(
+                _mm512_or_si512(_mm512_or_si512(va, a), _mm512_or_si512(vb, b)),
+                _mm512_or_si512(_mm512_or_si512(vc, c),
+                                _mm512_or_si512(vd, d)));
+            if (_mm512_movepi8_mask(check) != 0)
+            {
+                break;
+            }
+
+            const __m512i ma = _mm512_madd_epi16(
+                _mm512_maddubs_epi16(va, merge_ab_and_bc), merge_abc);
+            const __m512i mb = _mm512_madd_epi16(
+                _mm512_maddubs_epi16(vb, merge_ab_and_bc), merge_abc);
+            const __m512i mc = _mm512_madd_epi16(
+                _mm512_maddubs_epi16(vc, merge_ab_and_bc), merge_abc);
+            const __m512i md = _mm512_madd_epi16(
+                _mm512_maddubs_epi16(vd, merge_ab_and_bc), merge_abc);
+
+            _mm512_stream_si512((__m512i*)*out,
+                                _mm512_permutex2var_epi8(ma, pack0, mb));
+            _mm512_stream_si512((__m512i*)(*out + 64),
+                                _mm512_permutex2var_epi8(mb, pack1, mc));
+            _mm512_stream_si512((__m512i*)(*out + 128),
+                                _mm512_permutex2var_epi8(mc, pack2, md));
+
+            *src += 256;
+            *out += 192;
+            remaining -= 256;
+            written += 192;
+        }
+        _mm_sfence();
+    }
+    decode_loop_avx512_custom(src, remaining, out, written, table);
+}
+
+template <alphabet Alphabet>
+static inline void encode_loop_avx512(const uint8_t** src,
+                                      std::size_t& remaining, uint8_t** out,
+                                      std::size_t& written)
+{
+    encode_loop_avx512_custom(
+        src, remaining, out, written,
+        Alphabet == alphabet::url ? tables::encode_url : tables::encode);
+}
+
+template <alphabet Alphabet>
+static inline void decode_loop_avx512(const uint8_t** src,
+                                      std::size_t& remaining, uint8_t** out,
+                                      std::size_t& written)
+{
+    decode_loop_avx512_custom(
+        src, remaining, out, written,
+        Alphabet == alphabet::url ? tables::decode_url : tables::decode);
+}
+
+std::size_t base64_avx512::encode(const uint8_t* src, std::size_t size,
+                                  uint8_t* out)
+{
+    return base64_encode<alphabet::standard>(
+        &encode_loop_avx512<alphabet::standard>, src, size, out);
+}
+
+std::size_t base64_avx512::decode(const uint8_t* src, std::size_t size,
+                                  uint8_t* out, std::error_code& error)
+{
+    return base64_decode<alphabet::standard>(
+        &decode_loop_avx512<alphabet::standard>, src, size, out, error);
+}
+
+std::size_t base64_avx512::encode_url(const uint8_t* src, std::size_t size,
+                                      uint8_t* out)
+{
+    return base64_encode<alphabet::url>(
+        &encode_loop_avx512<alphabet::url>, src, size, out);
+}
+
+std::size_t base64_avx512::decode_url(const uint8_t* src, std::size_t size,
+                                      uint8_t* out, std::error_code& error)
+{
+    return base64_decode<alphabet::url>(
+        &decode_loop_avx512<alphabet::url>, src, size, out, error);
+}
+
+std::size_t base64_avx512::encode_stream(const uint8_t* src, std::size_t size,
+                                         uint8_t* out)
+{
+    return base64_encode<alphabet::standard>(
+        [](const uint8_t** src_it, std::size_t& remaining, uint8_t** out_it,
+           std::size_t& written)
+        {
+            encode_stream_avx512(src_it, remaining, out_it, written,
+                                 tables::encode);
+        },
+        src, size, out);
+}
+
+std::size_t base64_avx512::decode_stream(const uint8_t* src, std::size_t size,
+                                         uint8_t* out, std::error_code& error)
+{
+    return base64_decode<alphabet::standard>(
+        [](const uint8_t** src_it, std::size_t& remaining, uint8_t** out_it,
+           std::size_t& written)
+        {
+            decode_stream_avx512(src_it, remaining, out_it, written,
+                                 tables::decode, tables::decode_shifted);
+        },
+        src, size, out, error);
+}
+
+std::size_t base64_avx512::encode_stream_url(const uint8_t* src,
+                                             std::size_t size, uint8_t* out)
+{
+    return base64_encode<alphabet::url>(
+        [](const uint8_t** src_it, std::size_t& remaining, uint8_t** out_it,
+           std::size_t& written)
+        {
+            encode_stream_avx512(src_it, remaining, out_it, written,
+                                 tables::encode_url);
+        },
+        src, size, out);
+}
+
+std::size_t base64_avx512::decode_stream_url(const uint8_t* src,
+                                             std::size_t size, uint8_t* out,
+                                             std::error_code& error)
+{
+    return base64_decode<alphabet::url>(
+        [](const uint8_t** src_it, std::size_t& remaining, uint8_t** out_it,
+           std::size_t& written)
+        {
+            decode_stream_avx512(src_it, remaining, out_it, written,
+                                 tables::decode_url,
+                                 tables::decode_shifted_url);
+        },
+        src, size, out, error);
+}
+
+std::size_t base64_avx512::encode_custom(const uint8_t* src, std::size_t size,
+                                         uint8_t* out, const uint8_t* table)
+{
+    return base64_encode(
+        [table](const uint8_t** src_it, std::size_t& remaining,
+                uint8_t** out_it, std::size_t& written)
+        {
+            encode_loop_avx512_custom(src_it, remaining, out_it, written,
+                                      table);
+        },
+        table, src, size, out);
+}
+
+std::size_t base64_avx512::decode_custom(const uint8_t* src, std::size_t size,
+                                         uint8_t* out, const uint8_t* table,
+                                         std::error_code& error)
+{
+    return base64_decode(
+        [table](const uint8_t** src_it, std::size_t& remaining,
+                uint8_t** out_it, std::size_t& written)
+        {
+            decode_loop_avx512_custom(src_it, remaining, out_it, written,
+                                      table);
+        },
+        table, src, size, out, error);
+}
+
+bool base64_avx512::is_compiled()
+{
+    return true;
+}
+#else
+std::size_t base64_avx512::encode(const uint8_t*, std::size_t, uint8_t*)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_avx512::decode(const uint8_t*, std::size_t, uint8_t*,
+                                  std::error_code&)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_avx512::encode_url(const uint8_t*, std::size_t, uint8_t*)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_avx512::decode_url(const uint8_t*, std::size_t, uint8_t*,
+                                      std::error_code&)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_avx512::encode_stream(const uint8_t*, std::size_t,
+                                         uint8_t*)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_avx512::decode_stream(const uint8_t*, std::size_t,
+                                         uint8_t*, std::error_code&)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_avx512::encode_stream_url(const uint8_t*, std::size_t,
+                                             uint8_t*)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_avx512::decode_stream_url(const uint8_t*, std::size_t,
+                                             uint8_t*, std::error_code&)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_avx512::encode_custom(const uint8_t*, std::size_t, uint8_t*,
+                                         const uint8_t*)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_avx512::decode_custom(const uint8_t*, std::size_t, uint8_t*,
+                                         const uint8_t*, std::error_code&)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+bool base64_avx512::is_compiled()
+{
+    return false;
+}
+#endif
+}
+}
+}
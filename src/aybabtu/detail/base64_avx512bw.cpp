@@ -0,0 +1,542 @@
+// Copyright (c) Steinwurf ApS 2016.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include "base64_avx512bw.hpp"
+
+#include "base64_decode.hpp"
+#include "base64_encode.hpp"
+
+#include <platform/config.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <system_error>
+
+#include "../version.hpp"
+
+// Include x86 intrinsics for GCC-compatible compilers on x86/x86_64
+#if defined(PLATFORM_GCC_COMPATIBLE_X86)
+#include <x86intrin.h>
+#elif defined(PLATFORM_MSVC_X86)
+#include <immintrin.h>
+#endif
+
+namespace aybabtu
+{
+inline namespace STEINWURF_AYBABTU_VERSION
+{
+namespace detail
+{
+#if defined(PLATFORM_X86) && defined(__AVX512BW__)
+
+// This is the AVX2 codec widened to 512-bit registers. The shuffles used by
+// the AVX2 codec only move bytes within 128-bit lanes, so the same per-lane
+// constants are broadcast to all four lanes. See the AVX2 and SSSE3 codecs
+// for an explanation of the bit layout. Like the AVX-512VL codec, the partial
+// blocks at the end of the input are loaded and stored with the AVX-512 mask
+// registers.
+
+static inline __mmask64 byte_mask(std::size_t bytes)
+{
+    assert(bytes > 0 && bytes <= 64);
+    return (__mmask64)(~uint64_t(0) >> (64 - bytes));
+}
+
+template <alphabet Alphabet>
+static inline __m512i enc_translate(const __m512i in)
+{
+    // A lookup table containing the absolute offsets for all ranges:
+    const __m512i lut = _mm512_broadcast_i32x4(
+        Alphabet == alphabet::url
+            ? _mm_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4,
+                            -17, 32, 0, 0)
+            : _mm_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4,
+                            -19, -16, 0, 0));
+
+    // Create LUT indices from the input. The index for range #0 is right,
+    // others are 1 less than expected:
+    __m512i indices = _mm512_subs_epu8(in, _mm512_set1_epi8(51));
+
+    // Add 1 to indices for range #[1..4]. All indices are now correct:
+    indices = _mm512_mask_add_epi8(
+        indices, _mm512_cmpgt_epi8_mask(in, _mm512_set1_epi8(25)), indices,
+        _mm512_set1_epi8(1));
+
+    // Add offsets to input values:
+    return _mm512_add_epi8(in, _mm512_shuffle_epi8(lut, indices));
+}
+
+static inline __m512i enc_reshuffle(const __m512i input)
+{
+    // Spread the 48 input bytes over the four lanes, 12 bytes per lane:
+    const __m512i spread = _mm512_permutexvar_epi32(
+        _mm512_setr_epi32(0, 1, 2, 0, 3, 4, 5, 0, 6, 7, 8, 0, 9, 10, 11, 0),
+        input);
+
+    // Duplicate the middle byte of every 3-byte group:
+    const __m512i in = _mm512_shuffle_epi8(
+        spread, _mm512_broadcast_i32x4(_mm_setr_epi8(
+                    1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10)));
+
+    const __m512i t0 = _mm512_and_si512(in, _mm512_set1_epi32(0x0FC0FC00));
+    const __m512i t1 = _mm512_mulhi_epu16(t0, _mm512_set1_epi32(0x04000040));
+    const __m512i t2 = _mm512_and_si512(in, _mm512_set1_epi32(0x003F03F0));
+    const __m512i t3 = _mm512_mullo_epi16(t2, _mm512_set1_epi32(0x01000010));
+
+    return _mm512_or_si512(t1, t3);
+}
+
+template <alphabet Alphabet>
+static inline void encode_loop_avx512bw(const uint8_t** src,
+                                        std::size_t& remaining, uint8_t** out,
+                                        std::size_t& written)
+{
+    if (remaining >= 64)
+    {
+        // Process blocks of 48 bytes at a time. Because blocks are loaded 64
+        // bytes at a time, ensure that there will be at least 16 remaining
+        // bytes after the last round, so that the final read will not pass
+        // beyond the bounds of the input buffer:
+        std::size_t rounds = (remaining - 16) / 48;
+
+        remaining -= rounds * 48; // 48 bytes consumed per round
+        written += rounds * 64;   // 64 bytes produced per round
+
+        while (rounds > 0)
+        {
+            // Load input:
+            __m512i str = _mm512_loadu_si512((const void*)*src);
+
+            // Reshuffle, translate, store:
+            str = enc_reshuffle(str);
+            str = enc_translate<Alphabet>(str);
+            _mm512_storeu_si512((void*)*out, str);
+
+            *src += 48;
+            *out += 64;
+            rounds--;
+        }
+    }
+
+    // Encode the remaining whole 3-byte groups with masked loads and stores.
+    // The bytes outside the mask are never touched:
+    while (remaining >= 3)
+    {
+        const std::size_t bytes = std::min<std::size_t>(remaining / 3 * 3, 48);
+        const std::size_t chars = bytes / 3 * 4;
+
+        __m512i str = _mm512_maskz_loadu_epi8(byte_mask(bytes), *src);
+        str = enc_reshuffle(str);
+        str = enc_translate<Alphabet>(str);
+        _mm512_mask_storeu_epi8(*out, byte_mask(chars), str);
+
+        *src += bytes;
+        *out += chars;
+        remaining -= bytes;
+        written += chars;
+    }
+}
+
+static inline __m512i dec_reshuffle(const __m512i in)
+{
+    const __m512i merge_ab_and_bc =
+        _mm512_maddubs_epi16(in, _mm512_set1_epi32(0x01400140));
+
+    __m512i out =
+        _mm512_madd_epi16(merge_ab_and_bc, _mm512_set1_epi32(0x00011000));
+
+    // Pack bytes together in each lane:
+    out = _mm512_shuffle_epi8(
+        out, _mm512_broadcast_i32x4(_mm_setr_epi8(
+                 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1)));
+
+    // Pack lanes, the last four 32-bit words are taken from the zeroed upper
+    // part of the last lane:
+    return _mm512_permutexvar_epi32(
+        _mm512_setr_epi32(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 15, 15, 15,
+                          15),
+        out);
+}
+
+template <alphabet Alphabet>
+static inline __m512i dec_translate(const __m512i str, __mmask64* invalid)
+{
+    // See the SSSE3 decoder for the url alphabet lookup tables:
+    const __m512i lut_lo = _mm512_broadcast_i32x4(
+        Alphabet == alphabet::url
+            ? _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                            0x11, 0x11, 0x13, 0x3B, 0x3B, 0x3A, 0x3B, 0x33)
+            : _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                            0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A));
+
+    const __m512i lut_hi = _mm512_broadcast_i32x4(
+        Alphabet == alphabet::url
+            ? _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x20,
+                            0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10)
+            : _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                            0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10));
+
+    const __m512i lut_roll = _mm512_broadcast_i32x4(
+        Alphabet == alphabet::url
+            ? _mm_setr_epi8(-32, 0, 17, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0,
+                            0, 0, 0)
+            : _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0,
+                            0, 0, 0));
+
+    const __m512i mask_2F = _mm512_set1_epi8(0x2F);
+    const __m512i mask_5F = _mm512_set1_epi8(0x5F);
+
+    // See the SSSE3 decoder for an explanation of the algorithm.
+    const __m512i hi_nibbles =
+        _mm512_and_si512(_mm512_srli_epi32(str, 4), mask_2F);
+    const __m512i lo_nibbles = _mm512_and_si512(str, mask_2F);
+    const __m512i hi = _mm512_shuffle_epi8(lut_hi, hi_nibbles);
+    const __m512i lo = _mm512_shuffle_epi8(lut_lo, lo_nibbles);
+
+    // A byte is invalid if the "and" of its lo and hi values is not zero:
+    *invalid = _mm512_test_epi8_mask(lo, hi);
+
+    // Subtract 1 from the index of the '/' characters, or move the '_'
+    // characters to index 0:
+    const __m512i roll = _mm512_shuffle_epi8(
+        lut_roll,
+        Alphabet == alphabet::url
+            ? _mm512_mask_mov_epi8(hi_nibbles,
+                                   _mm512_cmpeq_epi8_mask(str, mask_5F),
+                                   _mm512_setzero_si512())
+            : _mm512_mask_sub_epi8(hi_nibbles,
+                                   _mm512_cmpeq_epi8_mask(str, mask_2F),
+                                   hi_nibbles, _mm512_set1_epi8(1)));
+
+    // Now simply add the delta values to the input:
+    return _mm512_add_epi8(str, roll);
+}
+
+template <alphabet Alphabet>
+static inline void decode_loop_avx512bw(const uint8_t** src,
+                                        std::size_t& remaining, uint8_t** out,
+                                        std::size_t& written)
+{
+    __mmask64 invalid;
+
+    if (remaining >= 88)
+    {
+        // Process blocks of 64 bytes per round. Because 16 extra zero bytes
+        // are written after the output, ensure that there will be at least 24
+        // bytes of input data left to cover the gap. (22 data bytes and up to
+        // two end-of-string markers.)
+        std::size_t rounds = (remaining - 24) / 64;
+
+        while (rounds > 0)
+        {
+            __m512i str = _mm512_loadu_si512((const void*)*src);
+            str = dec_translate<Alphabet>(str, &invalid);
+
+            // Fall back on bytewise code to do error checking and reporting:
+            if (invalid != 0)
+            {
+                return;
+            }
+
+            // Reshuffle the input to packed 48-byte output format:
+            str = dec_reshuffle(str);
+            _mm512_storeu_si512((void*)*out, str);
+
+            *src += 64;
+            *out += 48;
+            remaining -= 64; // 64 bytes consumed per round
+            written += 48;   // 48 bytes produced per round
+            rounds -= 1;
+        }
+    }
+
+    // Decode the remaining whole 4-character groups with masked loads and
+    // stores:
+    while (remaining >= 4)
+    {
+        const std::size_t chars = std::min<std::size_t>(remaining / 4 * 4, 64);
+        const std::size_t bytes = chars / 4 * 3;
+        const __mmask64 mask = byte_mask(chars);
+
+        __m512i str = _mm512_maskz_loadu_epi8(mask, *src);
+        str = dec_translate<Alphabet>(str, &invalid);
+
+        if ((invalid & mask) != 0)
+        {
+            return;
+        }
+
+        str = dec_reshuffle(str);
+        _mm512_mask_storeu_epi8(*out, byte_mask(bytes), str);
+
+        *src += chars;
+        *out += bytes;
+        remaining -= chars;
+        written += bytes;
+    }
+}
+
+// A custom alphabet has no ranges of consecutive characters to exploit, so
+// the translation is a plain lookup in 16-byte rows of the table, see the
+// SSSE3 codec. A masked pshufb merges each row into the values at or above
+// its first index, so the rows are used as they are.
+template <std::size_t Rows>
+static inline void load_rows(const uint8_t* table, __m512i* rows)
+{
+    for (std::size_t i = 0; i < Rows; ++i)
+    {
+        rows[i] = _mm512_broadcast_i32x4(
+            _mm_loadu_si128((const __m128i*)table + i));
+    }
+}
+
+template <std::size_t Rows>
+static inline __m512i lookup_rows(const __m512i* rows, const __m512i in)
+{
+    __m512i result = _mm512_shuffle_epi8(rows[0], in);
+    for (std::size_t i = 1; i < Rows; ++i)
+    {
+        result = _mm512_mask_shuffle_epi8(
+            result, _mm512_cmpgt_epi8_mask(in, _mm512_set1_epi8(i * 16 - 1)),
+            rows[i], in);
+    }
+    return result;
+}
+
+static inline void encode_loop_avx512bw_custom(const uint8_t** src,
+                                               std::size_t& remaining,
+                                               uint8_t** out,
+                                               std::size_t& written,
+                                               const uint8_t* table)
+{
+    if (remaining < 3)
+    {
+        return;
+    }
+
+    __m512i rows[4];
+    load_rows<4>(table, rows);
+
+    if (remaining >= 64)
+    {
+        // See encode_loop_avx512bw for the bounds:
+        std::size_t rounds = (remaining - 16) / 48;
+
+        remaining -= rounds * 48; // 48 bytes consumed per round
+        written += rounds * 64;   // 64 bytes produced per round
+
+        while (rounds > 0)
+        {
+            __m512i str = _mm512_loadu_si512((const void*)*src);
+            str = enc_reshuffle(str);
+            str = lookup_rows<4>(rows, str);
+            _mm512_storeu_si512((void*)*out, str);
+
+            *src += 48;
+            *out += 64;
+            rounds--;
+        }
+    }
+
+    // See encode_loop_avx512bw for the masked tail:
+    while (remaining >= 3)
+    {
+        const std::size_t bytes = std::min<std::size_t>(remaining / 3 * 3, 48);
+        const std::size_t chars = bytes / 3 * 4;
+
+        __m512i str = _mm512_maskz_loadu_epi8(byte_mask(bytes), *src);
+        str = enc_reshuffle(str);
+        str = lookup_rows<4>(rows, str);
+        _mm512_mask_storeu_epi8(*out, byte_mask(chars), str);
+
+        *src += bytes;
+        *out += chars;
+        remaining -= bytes;
+        written += chars;
+    }
+}
+
+static inline void decode_loop_avx512bw_custom(const uint8_t** src,
+                                               std::size_t& remaining,
+                                               uint8_t** out,
+                                               std::size_t& written,
+                                               const uint8_t* table)
+{
+    if (remaining < 4)
+    {
+        return;
+    }
+
+    __m512i rows[8];
+    load_rows<8>(table, rows);
+
+    if (remaining >= 88)
+    {
+        // See decode_loop_avx512bw for the bounds:
+        std::size_t rounds = (remaining - 24) / 64;
+
+        while (rounds > 0)
+        {
+            const __m512i str = _mm512_loadu_si512((const void*)*src);
+            const __m512i values = lookup_rows<8>(rows, str);
+
+            // Invalid characters have the most significant bit set in values,
+            // non-ASCII characters in str. Fall back on bytewise code to do
+            // error checking and reporting:
+            if (_mm512_movepi8_mask(_mm512_or_si512(values, str)) != 0)
+            {
+                return;
+            }
+
+            _mm512_storeu_si512((void*)*out, dec_reshuffle(values));
+
+            *src += 64;
+            *out += 48;
+            remaining -= 64; // 64 bytes consumed per round
+            written += 48;   // 48 bytes produced per round
+            rounds -= 1;
+        }
+    }
+
+    // See decode_loop_avx512bw for the masked tail:
+    while (remaining >= 4)
+    {
+        const std::size_t chars = std::min<std::size_t>(remaining / 4 * 4, 64);
+        const std::size_t bytes = chars / 4 * 3;
+        const __mmask64 mask = byte_mask(chars);
+
+        const __m512i str = _mm512_maskz_loadu_epi8(mask, *src);
+        const __m512i values = lookup_rows<8>(rows, str);
+
+        if ((_mm512_movepi8_mask(_mm512_or_si512(values, str)) & mask) != 0)
+        {
+            return;
+        }
+
+        _mm512_mask_storeu_epi8(*out, byte_mask(bytes), dec_reshuffle(values));
+
+        *src += chars;
+        *out += bytes;
+        remaining -= chars;
+        written += bytes;
+    }
+}
+
+std::size_t base64_avx512bw::encode(const uint8_t* src, std::size_t size,
+                                    uint8_t* out)
+{
+    return base64_encode<alphabet::standard>(
+        &encode_loop_avx512bw<alphabet::standard>, src, size, out);
+}
+
+std::size_t base64_avx512bw::decode(const uint8_t* src, std::size_t size,
+                                    uint8_t* out, std::error_code& error)
+{
+    return base64_decode<alphabet::standard>(
+        &decode_loop_avx512bw<alphabet::standard>, src, size, out, error);
+}
+
+std::size_t base64_avx512bw::encode_url(const uint8_t* src, std::size_t size,
+                                        uint8_t* out)
+{
+    return base64_encode<alphabet::url>(
+        &encode_loop_avx512bw<alphabet::url>, src, size, out);
+}
+
+std::size_t base64_avx512bw::decode_url(const uint8_t* src, std::size_t size,
+                                        uint8_t* out, std::error_code& error)
+{
+    return base64_decode<alphabet::url>(
+        &decode_loop_avx512bw<alphabet::url>, src, size, out, error);
+}
+
+std::size_t base64_avx512bw::encode_custom(const uint8_t* src, std::size_t size,
+                                           uint8_t* out, const uint8_t* table)
+{
+    return base64_encode(
+        [table](const uint8_t** src_it, std::size_t& remaining,
+                uint8_t** out_it, std::size_t& written)
+        {
+            encode_loop_avx512bw_custom(src_it, remaining, out_it, written,
+                                        table);
+        },
+        table, src, size, out);
+}
+
+std::size_t base64_avx512bw::decode_custom(const uint8_t* src, std::size_t size,
+                                           uint8_t* out, const uint8_t* table,
+                                           std::error_code& error)
+{
+    return base64_decode(
+        [table](const uint8_t** src_it, std::size_t& remaining,
+                uint8_t** out_it, std::size_t& written)
+        {
+            decode_loop_avx512bw_custom(src_it, remaining, out_it, written,
+                                        table);
+        },
+        table, src, size, out, error);
+}
+
+bool base64_avx512bw::is_compiled()
+{
+    return true;
+}
+#else
+std::size_t base64_avx512bw::encode(const uint8_t*, std::size_t, uint8_t*)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_avx512bw::decode(const uint8_t*, std::size_t, uint8_t*,
+                                    std::error_code&)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_avx512bw::encode_url(const uint8_t*, std::size_t, uint8_t*)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_avx512bw::decode_url(const uint8_t*, std::size_t, uint8_t*,
+                                        std::error_code&)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_avx512bw::encode_custom(const uint8_t*, std::size_t,
+                                           uint8_t*, const uint8_t*)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_avx512bw::decode_custom(const uint8_t*, std::size_t,
+                                           uint8_t*, const uint8_t*,
+                                           std::error_code&)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+bool base64_avx512bw::is_compiled()
+{
+    return false;
+}
+#endif
+}
+}
+}
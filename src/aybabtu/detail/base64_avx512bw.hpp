@@ -0,0 +1,51 @@
+// Copyright (c) Steinwurf ApS 2016.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include "../version.hpp"
+
+#include <cstdint>
+#include <system_error>
+
+namespace aybabtu
+{
+inline namespace STEINWURF_AYBABTU_VERSION
+{
+namespace detail
+{
+struct base64_avx512bw
+{
+    /// Encode with the standard alphabet, without padding
+    static std::size_t encode(const uint8_t* src, std::size_t size,
+                              uint8_t* out);
+
+    /// Decode with the standard alphabet, without padding
+    static std::size_t decode(const uint8_t* src, std::size_t size,
+                              uint8_t* out, std::error_code& error);
+
+    /// Encode with the URL and filename safe alphabet, without padding
+    static std::size_t encode_url(const uint8_t* src, std::size_t size,
+                                  uint8_t* out);
+
+    /// Decode with the URL and filename safe alphabet, without padding
+    static std::size_t decode_url(const uint8_t* src, std::size_t size,
+                                  uint8_t* out, std::error_code& error);
+
+    /// Encode with a custom alphabet, without padding
+    static std::size_t encode_custom(const uint8_t* src, std::size_t size,
+                                     uint8_t* out, const uint8_t* table);
+
+    /// Decode with a custom alphabet, without padding
+    static std::size_t decode_custom(const uint8_t* src, std::size_t size,
+                                     uint8_t* out, const uint8_t* table,
+                                     std::error_code& error);
+
+    /// @return whether this cpu acceralation is compiled or not
+    static bool is_compiled();
+};
+}
+}
+}
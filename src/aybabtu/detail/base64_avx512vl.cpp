@@ -0,0 +1,523 @@
+// Copyright (c) Steinwurf ApS 2016.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include "base64_avx512vl.hpp"
+
+#include "base64_decode.hpp"
+#include "base64_encode.hpp"
+
+#include <platform/config.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <system_error>
+
+#include "../version.hpp"
+
+// Include x86 intrinsics for GCC-compatible compilers on x86/x86_64
+#if defined(PLATFORM_GCC_COMPATIBLE_X86)
+#include <x86intrin.h>
+#elif defined(PLATFORM_MSVC_X86)
+#include <immintrin.h>
+#endif
+
+namespace aybabtu
+{
+inline namespace STEINWURF_AYBABTU_VERSION
+{
+namespace detail
+{
+#if defined(PLATFORM_X86) && defined(__AVX512BW__) && defined(__AVX512VL__)
+
+// This is the AVX2 codec restricted to 256-bit registers, so that it does not
+// trigger the frequency drop that comes with heavy 512-bit instructions. The
+// AVX-512 mask registers are used to load and store the partial blocks at the
+// end of the input, which the AVX2 codec leaves to the bytewise code. See the
+// AVX2 and SSSE3 codecs for an explanation of the bit layout.
+
+static inline __mmask32 byte_mask(std::size_t bytes)
+{
+    assert(bytes <= 32);
+    return (__mmask32)((uint64_t(1) << bytes) - 1);
+}
+
+template <alphabet Alphabet>
+static inline __m256i enc_translate(const __m256i in)
+{
+    // A lookup table containing the absolute offsets for all ranges:
+    const __m256i lut = _mm256_broadcastsi128_si256(
+        Alphabet == alphabet::url
+            ? _mm_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4,
+                            -17, 32, 0, 0)
+            : _mm_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4,
+                            -19, -16, 0, 0));
+
+    // Create LUT indices from the input. The index for range #0 is right,
+    // others are 1 less than expected:
+    __m256i indices = _mm256_subs_epu8(in, _mm256_set1_epi8(51));
+
+    // Add 1 to indices for range #[1..4]. All indices are now correct:
+    indices = _mm256_mask_add_epi8(
+        indices, _mm256_cmpgt_epi8_mask(in, _mm256_set1_epi8(25)), indices,
+        _mm256_set1_epi8(1));
+
+    // Add offsets to input values:
+    return _mm256_add_epi8(in, _mm256_shuffle_epi8(lut, indices));
+}
+
+static inline __m256i enc_reshuffle(const __m256i input)
+{
+    const __m256i in = _mm256_shuffle_epi8(
+        input,
+        _mm256_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1, 14,
+                        15, 13, 14, 11, 12, 10, 11, 8, 9, 7, 8, 5, 6, 4, 5));
+
+    const __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0FC0FC00));
+    const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+    const __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003F03F0));
+    const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+
+    return _mm256_or_si256(t1, t3);
+}
+
+template <alphabet Alphabet>
+static inline void encode_loop_avx512vl(const uint8_t** src,
+                                        std::size_t& remaining, uint8_t** out,
+                                        std::size_t& written)
+{
+    // Shift by 4 bytes, as required by enc_reshuffle:
+    const __m256i shift = _mm256_setr_epi32(0, 0, 1, 2, 3, 4, 5, 6);
+
+    if (remaining >= 32)
+    {
+        // Process blocks of 24 bytes at a time. Because blocks are loaded 32
+        // bytes at a time, ensure that there will be at least 8 remaining
+        // bytes after the last round, so that the final read will not pass
+        // beyond the bounds of the input buffer:
+        std::size_t rounds = (remaining - 8) / 24;
+
+        remaining -= rounds * 24; // 24 bytes consumed per round
+        written += rounds * 32;   // 32 bytes produced per round
+
+        while (rounds > 0)
+        {
+            __m256i str = _mm256_loadu_si256((__m256i*)*src);
+            str = _mm256_permutevar8x32_epi32(str, shift);
+            str = enc_reshuffle(str);
+            str = enc_translate<Alphabet>(str);
+            _mm256_storeu_si256((__m256i*)*out, str);
+
+            *src += 24;
+            *out += 32;
+            rounds--;
+        }
+    }
+
+    // Encode the remaining whole 3-byte groups with masked loads and stores.
+    // The bytes outside the mask are never touched, so the tail can be read
+    // and written in place:
+    while (remaining >= 3)
+    {
+        const std::size_t bytes = std::min<std::size_t>(remaining / 3 * 3, 24);
+        const std::size_t chars = bytes / 3 * 4;
+
+        __m256i str = _mm256_maskz_loadu_epi8(byte_mask(bytes), *src);
+        str = _mm256_permutevar8x32_epi32(str, shift);
+        str = enc_reshuffle(str);
+        str = enc_translate<Alphabet>(str);
+        _mm256_mask_storeu_epi8(*out, byte_mask(chars), str);
+
+        *src += bytes;
+        *out += chars;
+        remaining -= bytes;
+        written += chars;
+    }
+}
+
+static inline __m256i dec_reshuffle(const __m256i in)
+{
+    const __m256i merge_ab_and_bc =
+        _mm256_maddubs_epi16(in, _mm256_set1_epi32(0x01400140));
+
+    __m256i out =
+        _mm256_madd_epi16(merge_ab_and_bc, _mm256_set1_epi32(0x00011000));
+
+    // Pack bytes together in each lane:
+    out = _mm256_shuffle_epi8(
+        out, _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1,
+                              -1, -1, 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12,
+                              -1, -1, -1, -1));
+
+    // Pack lanes:
+    return _mm256_permutevar8x32_epi32(
+        out, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, -1, -1));
+}
+
+template <alphabet Alphabet>
+static inline __m256i dec_translate(const __m256i str, __mmask32* invalid)
+{
+    // See the SSSE3 decoder for the url alphabet lookup tables:
+    const __m256i lut_lo = _mm256_broadcastsi128_si256(
+        Alphabet == alphabet::url
+            ? _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                            0x11, 0x11, 0x13, 0x3B, 0x3B, 0x3A, 0x3B, 0x33)
+            : _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                            0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A));
+
+    const __m256i lut_hi = _mm256_broadcastsi128_si256(
+        Alphabet == alphabet::url
+            ? _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x20,
+                            0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10)
+            : _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                            0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10));
+
+    const __m256i lut_roll = _mm256_broadcastsi128_si256(
+        Alphabet == alphabet::url
+            ? _mm_setr_epi8(-32, 0, 17, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0,
+                            0, 0, 0)
+            : _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0,
+                            0, 0, 0));
+
+    const __m256i mask_2F = _mm256_set1_epi8(0x2F);
+    const __m256i mask_5F = _mm256_set1_epi8(0x5F);
+
+    // See the SSSE3 decoder for an explanation of the algorithm.
+    const __m256i hi_nibbles =
+        _mm256_and_si256(_mm256_srli_epi32(str, 4), mask_2F);
+    const __m256i lo_nibbles = _mm256_and_si256(str, mask_2F);
+    const __m256i hi = _mm256_shuffle_epi8(lut_hi, hi_nibbles);
+    const __m256i lo = _mm256_shuffle_epi8(lut_lo, lo_nibbles);
+
+    // A byte is invalid if the "and" of its lo and hi values is not zero:
+    *invalid = _mm256_test_epi8_mask(lo, hi);
+
+    // Subtract 1 from the index of the '/' characters, or move the '_'
+    // characters to index 0:
+    const __m256i roll = _mm256_shuffle_epi8(
+        lut_roll, Alphabet == alphabet::url
+                      ? _mm256_mask_mov_epi8(
+                            hi_nibbles, _mm256_cmpeq_epi8_mask(str, mask_5F),
+                            _mm256_setzero_si256())
+                      : _mm256_mask_sub_epi8(
+                            hi_nibbles, _mm256_cmpeq_epi8_mask(str, mask_2F),
+                            hi_nibbles, _mm256_set1_epi8(1)));
+
+    // Now simply add the delta values to the input:
+    return _mm256_add_epi8(str, roll);
+}
+
+template <alphabet Alphabet>
+static inline void decode_loop_avx512vl(const uint8_t** src,
+                                        std::size_t& remaining, uint8_t** out,
+                                        std::size_t& written)
+{
+    __mmask32 invalid;
+
+    if (remaining >= 45)
+    {
+        // Process blocks of 32 bytes per round. Because 8 extra zero bytes
+        // are written after the output, ensure that there will be at least 13
+        // bytes of input data left to cover the gap. (11 data bytes and up to
+        // two end-of-string markers.)
+        std::size_t rounds = (remaining - 13) / 32;
+
+        while (rounds > 0)
+        {
+            __m256i str = _mm256_loadu_si256((__m256i*)*src);
+            str = dec_translate<Alphabet>(str, &invalid);
+
+            // Fall back on bytewise code to do error checking and reporting:
+            if (invalid != 0)
+            {
+                return;
+            }
+
+            str = dec_reshuffle(str);
+            _mm256_storeu_si256((__m256i*)*out, str);
+
+            *src += 32;
+            *out += 24;
+            remaining -= 32; // 32 bytes consumed per round
+            written += 24;   // 24 bytes produced per round
+            rounds -= 1;
+        }
+    }
+
+    // Decode the remaining whole 4-character groups with masked loads and
+    // stores:
+    while (remaining >= 4)
+    {
+        const std::size_t chars = std::min<std::size_t>(remaining / 4 * 4, 32);
+        const std::size_t bytes = chars / 4 * 3;
+        const __mmask32 mask = byte_mask(chars);
+
+        __m256i str = _mm256_maskz_loadu_epi8(mask, *src);
+        str = dec_translate<Alphabet>(str, &invalid);
+
+        if ((invalid & mask) != 0)
+        {
+            return;
+        }
+
+        str = dec_reshuffle(str);
+        _mm256_mask_storeu_epi8(*out, byte_mask(bytes), str);
+
+        *src += chars;
+        *out += bytes;
+        remaining -= chars;
+        written += bytes;
+    }
+}
+
+// A custom alphabet has no ranges of consecutive characters to exploit, so
+// the translation is a plain lookup in 16-byte rows of the table, see the
+// SSSE3 and AVX-512BW codecs.
+template <std::size_t Rows>
+static inline void load_rows(const uint8_t* table, __m256i* rows)
+{
+    for (std::size_t i = 0; i < Rows; ++i)
+    {
+        rows[i] = _mm256_broadcastsi128_si256(
+            _mm_loadu_si128((const __m128i*)table + i));
+    }
+}
+
+template <std::size_t Rows>
+static inline __m256i lookup_rows(const __m256i* rows, const __m256i in)
+{
+    __m256i result = _mm256_shuffle_epi8(rows[0], in);
+    for (std::size_t i = 1; i < Rows; ++i)
+    {
+        result = _mm256_mask_shuffle_epi8(
+            result, _mm256_cmpgt_epi8_mask(in, _mm256_set1_epi8(i * 16 - 1)),
+            rows[i], in);
+    }
+    return result;
+}
+
+static inline void encode_loop_avx512vl_custom(const uint8_t** src,
+                                               std::size_t& remaining,
+                                               uint8_t** out,
+                                               std::size_t& written,
+                                               const uint8_t* table)
+{
+    if (remaining < 3)
+    {
+        return;
+    }
+
+    const __m256i shift = _mm256_setr_epi32(0, 0, 1, 2, 3, 4, 5, 6);
+
+    __m256i rows[4];
+    load_rows<4>(table, rows);
+
+    // See encode_loop_avx512vl for the bounds and the masked tail:
+    while (remaining >= 32)
+    {
+        __m256i str = _mm256_loadu_si256((__m256i*)*src);
+        str = _mm256_permutevar8x32_epi32(str, shift);
+        str = enc_reshuffle(str);
+        str = lookup_rows<4>(rows, str);
+        _mm256_storeu_si256((__m256i*)*out, str);
+
+        *src += 24;
+        *out += 32;
+        remaining -= 24; // 24 bytes consumed per round
+        written += 32;   // 32 bytes produced per round
+    }
+
+    while (remaining >= 3)
+    {
+        const std::size_t bytes = std::min<std::size_t>(remaining / 3 * 3, 24);
+        const std::size_t chars = bytes / 3 * 4;
+
+        __m256i str = _mm256_maskz_loadu_epi8(byte_mask(bytes), *src);
+        str = _mm256_permutevar8x32_epi32(str, shift);
+        str = enc_reshuffle(str);
+        str = lookup_rows<4>(rows, str);
+        _mm256_mask_storeu_epi8(*out, byte_mask(chars), str);
+
+        *src += bytes;
+        *out += chars;
+        remaining -= bytes;
+        written += chars;
+    }
+}
+
+static inline void decode_loop_avx512vl_custom(const uint8_t** src,
+                                               std::size_t& remaining,
+                                               uint8_t** out,
+                                               std::size_t& written,
+                                               const uint8_t* table)
+{
+    if (remaining < 8)
+    {
+        return;
+    }
+
+    __m256i rows[8];
+    load_rows<8>(table, rows);
+
+    // See decode_loop_avx512vl for the bounds and the masked tail:
+    while (remaining >= 45)
+    {
+        const __m256i str = _mm256_loadu_si256((__m256i*)*src);
+        const __m256i values = lookup_rows<8>(rows, str);
+
+        // Invalid characters have the most significant bit set in values,
+        // non-ASCII characters in str. Fall back on bytewise code to do error
+        // checking and reporting:
+        if (_mm256_movepi8_mask(_mm256_or_si256(values, str)) != 0)
+        {
+            return;
+        }
+
+        _mm256_storeu_si256((__m256i*)*out, dec_reshuffle(values));
+
+        *src += 32;
+        *out += 24;
+        remaining -= 32; // 32 bytes consumed per round
+        written += 24;   // 24 bytes produced per round
+    }
+
+    while (remaining >= 4)
+    {
+        const std::size_t chars = std::min<std::size_t>(remaining / 4 * 4, 32);
+        const std::size_t bytes = chars / 4 * 3;
+        const __mmask32 mask = byte_mask(chars);
+
+        const __m256i str = _mm256_maskz_loadu_epi8(mask, *src);
+        const __m256i values = lookup_rows<8>(rows, str);
+
+        if ((_mm256_movepi8_mask(_mm256_or_si256(values, str)) & mask) != 0)
+        {
+            return;
+        }
+
+        _mm256_mask_storeu_epi8(*out, byte_mask(bytes), dec_reshuffle(values));
+
+        *src += chars;
+        *out += bytes;
+        remaining -= chars;
+        written += bytes;
+    }
+}
+
+std::size_t base64_avx512vl::encode(const uint8_t* src, std::size_t size,
+                                    uint8_t* out)
+{
+    return base64_encode<alphabet::standard>(
+        &encode_loop_avx512vl<alphabet::standard>, src, size, out);
+}
+
+std::size_t base64_avx512vl::decode(const uint8_t* src, std::size_t size,
+                                    uint8_t* out, std::error_code& error)
+{
+    return base64_decode<alphabet::standard>(
+        &decode_loop_avx512vl<alphabet::standard>, src, size, out, error);
+}
+
+std::size_t base64_avx512vl::encode_url(const uint8_t* src, std::size_t size,
+                                        uint8_t* out)
+{
+    return base64_encode<alphabet::url>(
+        &encode_loop_avx512vl<alphabet::url>, src, size, out);
+}
+
+std::size_t base64_avx512vl::decode_url(const uint8_t* src, std::size_t size,
+                                        uint8_t* out, std::error_code& error)
+{
+    return base64_decode<alphabet::url>(
+        &decode_loop_avx512vl<alphabet::url>, src, size, out, error);
+}
+
+std::size_t base64_avx512vl::encode_custom(const uint8_t* src, std::size_t size,
+                                           uint8_t* out, const uint8_t* table)
+{
+    return base64_encode(
+        [table](const uint8_t** src_it, std::size_t& remaining,
+                uint8_t** out_it, std::size_t& written)
+        {
+            encode_loop_avx512vl_custom(src_it, remaining, out_it, written,
+                                        table);
+        },
+        table, src, size, out);
+}
+
+std::size_t base64_avx512vl::decode_custom(const uint8_t* src, std::size_t size,
+                                           uint8_t* out, const uint8_t* table,
+                                           std::error_code& error)
+{
+    return base64_decode(
+        [table](const uint8_t** src_it, std::size_t& remaining,
+                uint8_t** out_it, std::size_t& written)
+        {
+            decode_loop_avx512vl_custom(src_it, remaining, out_it, written,
+                                        table);
+        },
+        table, src, size, out, error);
+}
+
+bool base64_avx512vl::is_compiled()
+{
+    return true;
+}
+#else
+std::size_t base64_avx512vl::encode(const uint8_t*, std::size_t, uint8_t*)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_avx512vl::decode(const uint8_t*, std::size_t, uint8_t*,
+                                    std::error_code&)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_avx512vl::encode_url(const uint8_t*, std::size_t, uint8_t*)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_avx512vl::decode_url(const uint8_t*, std::size_t, uint8_t*,
+                                        std::error_code&)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_avx512vl::encode_custom(const uint8_t*, std::size_t,
+                                           uint8_t*, const uint8_t*)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_avx512vl::decode_custom(const uint8_t*, std::size_t,
+                                           uint8_t*, const uint8_t*,
+                                           std::error_code&)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+bool base64_avx512vl::is_compiled()
+{
+    return false;
+}
+#endif
+}
+}
+}
@@ -6,6 +6,8 @@
 #include "base64_basic.hpp"
 #include "base64_decode.hpp"
 #include "base64_encode.hpp"
+#include "base64_validate.hpp"
+#include "strip_whitespace.hpp"
 
 #include "../version.hpp"
 
@@ -23,18 +25,105 @@ static inline void noop(const uint8_t**, std::size_t&, uint8_t**, size_t&)
 {
 }
 
+static inline void noop_backward(uint8_t*, std::size_t&)
+{
+}
+
+static inline bool noop_validate(const uint8_t**, std::size_t&)
+{
+    return true;
+}
+
+template <alphabet Alphabet>
+static inline bool validate_basic(const uint8_t** src, std::size_t& remaining)
+{
+    return validate_blocks(Alphabet == alphabet::url
+                               ? tables::decode_shifted_url
+                               : tables::decode_shifted,
+                           src, remaining);
+}
+
 std::size_t base64_basic::encode(const uint8_t* src, std::size_t size,
                                  uint8_t* out)
 {
 
-    return base64_encode(&noop, src, size, out);
+    return base64_encode<alphabet::standard>(&noop, src, size, out);
 }
 
 std::size_t base64_basic::decode(const uint8_t* src, std::size_t size,
                                  uint8_t* out, std::error_code& error)
 
 {
-    return base64_decode(&noop, src, size, out, error);
+    return base64_decode<alphabet::standard>(&noop, src, size, out, error);
+}
+
+std::size_t base64_basic::encode_url(const uint8_t* src, std::size_t size,
+                                     uint8_t* out)
+{
+    return base64_encode<alphabet::url>(&noop, src, size, out);
+}
+
+std::size_t base64_basic::decode_url(const uint8_t* src, std::size_t size,
+                                     uint8_t* out, std::error_code& error)
+{
+    return base64_decode<alphabet::url>(&noop, src, size, out, error);
+}
+
+std::size_t base64_basic::encode_custom(const uint8_t* src, std::size_t size,
+                                        uint8_t* out, const uint8_t* table)
+{
+    return base64_encode(&noop, table, src, size, out);
+}
+
+std::size_t base64_basic::decode_custom(const uint8_t* src, std::size_t size,
+                                        uint8_t* out, const uint8_t* table,
+                                        std::error_code& error)
+{
+    return base64_decode(&noop, table, src, size, out, error);
+}
+
+std::size_t base64_basic::encode_inplace(uint8_t* buffer, std::size_t size)
+{
+    return base64_encode_backward(&noop_backward, tables::encode, buffer,
+                                  size);
+}
+
+std::size_t base64_basic::encode_inplace_url(uint8_t* buffer,
+                                             std::size_t size)
+{
+    return base64_encode_backward(&noop_backward, tables::encode_url, buffer,
+                                  size);
+}
+
+std::size_t base64_basic::encode_inplace_custom(uint8_t* buffer,
+                                                std::size_t size,
+                                                const uint8_t* table)
+{
+    return base64_encode_backward(&noop_backward, table, buffer, size);
+}
+
+bool base64_basic::validate(const uint8_t* src, std::size_t size)
+{
+    return base64_validate(&validate_basic<alphabet::standard>, tables::decode,
+                           src, size);
+}
+
+bool base64_basic::validate_url(const uint8_t* src, std::size_t size)
+{
+    return base64_validate(&validate_basic<alphabet::url>,
+                           tables::decode_url, src, size);
+}
+
+bool base64_basic::validate_custom(const uint8_t* src, std::size_t size,
+                                   const uint8_t* table)
+{
+    return base64_validate(&noop_validate, table, src, size);
+}
+
+std::size_t base64_basic::strip_whitespace(const uint8_t* src, std::size_t size,
+                                           uint8_t* out)
+{
+    return detail::strip_whitespace(&noop, src, size, out);
 }
 }
 }
@@ -5,9 +5,11 @@
 
 #pragma once
 
+#include "../alphabet.hpp"
 #include "../version.hpp"
 #include "tables.hpp"
 
+#include <cassert>
 #include <cstdint>
 #include <system_error>
 
@@ -17,12 +19,82 @@ inline namespace STEINWURF_AYBABTU_VERSION
 {
 namespace detail
 {
+/// Decode whole groups of 4 characters to 3 bytes each, using four 256
+/// entry tables that map every character to its 6-bit value shifted to its
+/// place in the decoded 24 bits, see tables::decode_shifted. Decoding stops
+/// at the first group with an invalid character, which is left for the
+/// caller to report.
+static inline void decode_blocks(const uint32_t* shifted, const uint8_t** src,
+                                 std::size_t& remaining, uint8_t** out,
+                                 std::size_t& written)
+{
+    const uint8_t* in = *src;
+    uint8_t* it = *out;
+    const uint8_t* end = in + remaining / 4 * 4;
+
+    while (in != end)
+    {
+        const uint32_t word = shifted[in[0]] | shifted[256 + in[1]] |
+                              shifted[512 + in[2]] | shifted[768 + in[3]];
+        if (word >> 24 != 0)
+        {
+            break;
+        }
+
+        it[0] = (uint8_t)(word >> 16);
+        it[1] = (uint8_t)(word >> 8);
+        it[2] = (uint8_t)word;
+        in += 4;
+        it += 3;
+    }
+
+    remaining -= in - *src;
+    written += it - *out;
+    *src = in;
+    *out = it;
+}
+
+/// Decode whole groups a group at a time until out is aligned to alignment
+/// bytes, 16, 32 or 64, for loops with aligned stores, see decode_blocks.
+/// @return true if out is aligned, false if the input ran out or holds an
+///         invalid character first
+static inline bool decode_align(const uint32_t* shifted, const uint8_t** src,
+                                std::size_t& remaining, uint8_t** out,
+                                std::size_t& written, std::size_t alignment)
+{
+    assert(alignment == 16 || alignment == 32 || alignment == 64);
+
+    // Every group advances out by 3 bytes, and 3 * 43 is 1 modulo 16, 32 and
+    // 64, so 43 groups advance it by a single byte:
+    const std::size_t misalignment = (uintptr_t)*out % alignment;
+    std::size_t peel = (alignment - misalignment) * 43 % alignment * 4;
+    if (peel > remaining)
+    {
+        return false;
+    }
+
+    remaining -= peel;
+    decode_blocks(shifted, src, peel, out, written);
+    remaining += peel;
+    return peel == 0;
+}
+
+/// Decode without padding, using a 256 entry table that maps every
+/// character to its 6-bit value, or to 254 or 255 if it is invalid. If
+/// shifted is not null, the groups left by func are decoded a group at a
+/// time, see decode_blocks. The padding is removed by the caller, so the
+/// last group may hold 2 or 3 characters and '=' is treated as invalid.
+///
+/// On an invalid character the error is set and the number of bytes decoded
+/// before the group holding the character is returned, so the caller can
+/// locate it without scanning the string again.
 template <class Func>
-static inline std::size_t base64_decode(Func func, const uint8_t* src,
-                                        std::size_t size, uint8_t* out,
-                                        std::error_code& error)
+static inline std::size_t base64_decode(Func func, const uint8_t* table,
+                                        const uint32_t* shifted,
+                                        const uint8_t* src, std::size_t size,
+                                        uint8_t* out, std::error_code& error)
 {
-    if (size % 4)
+    if (size % 4 == 1)
     {
         error = std::make_error_code(std::errc::invalid_argument);
         return 0;
@@ -39,30 +111,32 @@ static inline std::size_t base64_decode(Func func, const uint8_t* src,
     while (true)
     {
         func(&src, remaining, &out, written);
+        if (shifted != nullptr)
+        {
+            decode_blocks(shifted, &src, remaining, &out, written);
+        }
         if (remaining-- == 0)
         {
             return written;
         }
 
-        uint8_t q = tables::decode[*src++];
+        const std::size_t group = written;
+        uint8_t q = table[*src++];
         if (q >= 254)
         {
-            // Treat character '=' as invalid for byte 0:
             error = std::make_error_code(std::errc::invalid_argument);
-            return 0;
+            return group;
         }
         std::size_t carry = q << 2;
 
-        if (remaining-- == 0)
-        {
-            return written;
-        }
-        q = tables::decode[*src++];
+        // The size check above ensures that a group never holds a single
+        // character:
+        remaining--;
+        q = table[*src++];
         if (q >= 254)
         {
-            // Treat character '=' as invalid for byte 1:
             error = std::make_error_code(std::errc::invalid_argument);
-            return 0;
+            return group;
         }
         *out++ = carry | (q >> 4);
         carry = q << 4;
@@ -72,29 +146,11 @@ static inline std::size_t base64_decode(Func func, const uint8_t* src,
         {
             return written;
         }
-        q = tables::decode[*src++];
+        q = table[*src++];
         if (q >= 254)
         {
-            // When q == 254, the input char is '='.
-            if (q == 254)
-            {
-                // Check if next byte is also '=':
-                if (remaining == 1)
-                {
-                    remaining--;
-                    q = tables::decode[*src++];
-                    if (q != 254)
-                    {
-                        error =
-                            std::make_error_code(std::errc::invalid_argument);
-                        return 0;
-                    }
-                    return written;
-                }
-            }
-            // If we get here, there was an error:
             error = std::make_error_code(std::errc::invalid_argument);
-            return 0;
+            return group;
         }
         *out++ = carry | (q >> 2);
         carry = q << 6;
@@ -104,22 +160,39 @@ static inline std::size_t base64_decode(Func func, const uint8_t* src,
         {
             return written;
         }
-        q = tables::decode[*src++];
-        // When q == 254, the input char is '='.
-        if (q == 254)
-        {
-            return written;
-        }
-        if (q == 255)
+        q = table[*src++];
+        if (q >= 254)
         {
             error = std::make_error_code(std::errc::invalid_argument);
-            return 0;
+            return group;
         }
-
         *out++ = carry | q;
         written++;
     }
 }
+
+/// Decode without padding, using a 256 entry table that maps every
+/// character to its 6-bit value, e.g. the table of a custom alphabet.
+template <class Func>
+static inline std::size_t base64_decode(Func func, const uint8_t* table,
+                                        const uint8_t* src, std::size_t size,
+                                        uint8_t* out, std::error_code& error)
+{
+    return base64_decode(func, table, nullptr, src, size, out, error);
+}
+
+/// Decode without padding, using one of the built-in alphabets.
+template <alphabet Alphabet, class Func>
+static inline std::size_t base64_decode(Func func, const uint8_t* src,
+                                        std::size_t size, uint8_t* out,
+                                        std::error_code& error)
+{
+    return base64_decode(
+        func, Alphabet == alphabet::url ? tables::decode_url : tables::decode,
+        Alphabet == alphabet::url ? tables::decode_shifted_url
+                                  : tables::decode_shifted,
+        src, size, out, error);
+}
 }
 }
 }
@@ -5,10 +5,12 @@
 
 #pragma once
 
+#include "../alphabet.hpp"
 #include "../version.hpp"
 #include "tables.hpp"
 
 #include <cstdint>
+#include <cstring>
 
 namespace aybabtu
 {
@@ -17,9 +19,69 @@ inline namespace STEINWURF_AYBABTU_VERSION
 namespace detail
 {
 
-template <class Func, int Chunk = 0>
-static inline std::size_t base64_encode(Func func, const uint8_t* src,
-                                        std::size_t size, uint8_t* out)
+/// Encode the upper 48 bits of word to 8 characters, using a 4096 entry
+/// table that maps every 12-bit value to a pair of characters.
+static inline void encode_block(const uint8_t* pairs, uint64_t word,
+                                uint8_t* out)
+{
+    std::memcpy(out, pairs + ((word >> 51) & 0x1FFE), 2);
+    std::memcpy(out + 2, pairs + ((word >> 39) & 0x1FFE), 2);
+    std::memcpy(out + 4, pairs + ((word >> 27) & 0x1FFE), 2);
+    std::memcpy(out + 6, pairs + ((word >> 15) & 0x1FFE), 2);
+}
+
+/// Encode blocks of 6 bytes, 8 characters at a time, see encode_block. The
+/// bytes that do not fill a block are left for the caller.
+static inline void encode_blocks(const uint8_t* pairs, const uint8_t** src,
+                                 std::size_t& remaining, uint8_t** out,
+                                 std::size_t& written)
+{
+    const uint8_t* in = *src;
+    uint8_t* it = *out;
+    const std::size_t blocks = remaining / 6;
+
+    // Read 8 bytes at a time and use the first 6. The shifts are compiled to
+    // a single byte-swapping load:
+    for (std::size_t i = remaining >= 8 ? (remaining - 2) / 6 : 0; i > 0;
+         --i)
+    {
+        const uint64_t word =
+            (uint64_t)in[0] << 56 | (uint64_t)in[1] << 48 |
+            (uint64_t)in[2] << 40 | (uint64_t)in[3] << 32 |
+            (uint64_t)in[4] << 24 | (uint64_t)in[5] << 16 |
+            (uint64_t)in[6] << 8 | (uint64_t)in[7];
+        encode_block(pairs, word, it);
+        in += 6;
+        it += 8;
+    }
+
+    // The last block may be followed by less than 2 bytes:
+    if (in != *src + blocks * 6)
+    {
+        const uint64_t word =
+            (uint64_t)in[0] << 56 | (uint64_t)in[1] << 48 |
+            (uint64_t)in[2] << 40 | (uint64_t)in[3] << 32 |
+            (uint64_t)in[4] << 24 | (uint64_t)in[5] << 16;
+        encode_block(pairs, word, it);
+        in += 6;
+        it += 8;
+    }
+
+    *src = in;
+    *out = it;
+    remaining -= blocks * 6;
+    written += blocks * 8;
+}
+
+/// Encode without padding, using a 64 entry table that maps every 6-bit
+/// value to a character. If pairs is not null, the bytes left by func are
+/// encoded 6 at a time, see encode_blocks. The padding is added by the
+/// caller when needed.
+template <class Func>
+static inline std::size_t base64_encode(Func func, const uint8_t* table,
+                                        const uint8_t* pairs,
+                                        const uint8_t* src, std::size_t size,
+                                        uint8_t* out)
 {
     std::size_t written = 0;
     std::size_t remaining = size;
@@ -27,41 +89,147 @@ static inline std::size_t base64_encode(Func func, const uint8_t* src,
     while (true)
     {
         func(&src, remaining, &out, written);
+        if (pairs != nullptr)
+        {
+            encode_blocks(pairs, &src, remaining, &out, written);
+        }
         if (remaining == 0)
         {
             return written;
         }
-        *out++ = tables::encode[*src >> 2];
+        *out++ = table[*src >> 2];
         written += 1;
         remaining -= 1;
 
         uint8_t carry = (*src++ << 4) & 0x30;
         if (remaining == 0)
         {
-            *out++ = tables::encode[carry];
-            *out++ = '=';
-            *out++ = '=';
-            written += 3;
+            *out++ = table[carry];
+            written += 1;
             return written;
         }
-        *out++ = tables::encode[carry | (*src >> 4)];
+        *out++ = table[carry | (*src >> 4)];
         written += 1;
         remaining -= 1;
 
         carry = (*src++ << 2) & 0x3C;
         if (remaining == 0)
         {
-            *out++ = tables::encode[carry];
-            *out++ = '=';
-            written += 2;
+            *out++ = table[carry];
+            written += 1;
             return written;
         }
-        *out++ = tables::encode[carry | (*src >> 6)];
-        *out++ = tables::encode[*src++ & 0x3F];
+        *out++ = table[carry | (*src >> 6)];
+        *out++ = table[*src++ & 0x3F];
         written += 2;
         remaining -= 1;
     }
 }
+
+/// Encode without padding, using a 64 entry table that maps every 6-bit
+/// value to a character, e.g. the table of a custom alphabet.
+template <class Func>
+static inline std::size_t base64_encode(Func func, const uint8_t* table,
+                                        const uint8_t* src, std::size_t size,
+                                        uint8_t* out)
+{
+    return base64_encode(func, table, nullptr, src, size, out);
+}
+
+/// Encode a group of 3 bytes to 4 characters. The bytes are read before the
+/// characters are written, so out may overlap src.
+static inline void encode_group(const uint8_t* table, const uint8_t* src,
+                                uint8_t* out)
+{
+    const uint8_t b0 = src[0];
+    const uint8_t b1 = src[1];
+    const uint8_t b2 = src[2];
+    out[0] = table[b0 >> 2];
+    out[1] = table[((b0 << 4) & 0x30) | (b1 >> 4)];
+    out[2] = table[((b1 << 2) & 0x3C) | (b2 >> 6)];
+    out[3] = table[b2 & 0x3F];
+}
+
+/// Encode whole groups a group at a time until out is aligned to alignment
+/// bytes, for loops with aligned stores.
+/// @return true if out is aligned, false if it cannot be aligned because it
+///         is not a multiple of 4 bytes away from an aligned address, or
+///         because the input ran out first
+static inline bool encode_align(const uint8_t* table, const uint8_t** src,
+                                std::size_t& remaining, uint8_t** out,
+                                std::size_t& written, std::size_t alignment)
+{
+    if ((uintptr_t)*out % 4 != 0)
+    {
+        return false;
+    }
+
+    while ((uintptr_t)*out % alignment != 0 && remaining >= 3)
+    {
+        encode_group(table, *src, *out);
+        *src += 3;
+        *out += 4;
+        remaining -= 3;
+        written += 4;
+    }
+    return (uintptr_t)*out % alignment == 0;
+}
+
+/// Encode without padding from the back of the buffer to the front, so that
+/// the characters overwrite the data they encode. The data is at the start
+/// of the buffer, which must be large enough for the characters.
+///
+/// The func callback is called with the size of the whole groups that are
+/// not encoded yet, at the start of the buffer, and encodes some of them
+/// from the back. The rest is encoded a group at a time.
+/// @return the number of characters
+template <class Func>
+static inline std::size_t base64_encode_backward(Func func,
+                                                 const uint8_t* table,
+                                                 uint8_t* buffer,
+                                                 std::size_t size)
+{
+    std::size_t remaining = size / 3 * 3;
+    std::size_t written = remaining / 3 * 4;
+
+    // The partial group at the end. Its bytes may be overwritten by its own
+    // characters, so they are read first:
+    if (size != remaining)
+    {
+        const uint8_t b0 = buffer[remaining];
+        const uint8_t b1 = size - remaining == 2 ? buffer[remaining + 1] : 0;
+        uint8_t* out = buffer + written;
+        out[0] = table[b0 >> 2];
+        out[1] = table[((b0 << 4) & 0x30) | (b1 >> 4)];
+        written += 2;
+        if (size - remaining == 2)
+        {
+            out[2] = table[(b1 << 2) & 0x3C];
+            written += 1;
+        }
+    }
+
+    func(buffer, remaining);
+
+    while (remaining > 0)
+    {
+        remaining -= 3;
+        encode_group(table, buffer + remaining, buffer + remaining / 3 * 4);
+    }
+    return written;
+}
+
+/// Encode without padding, using one of the built-in alphabets.
+template <alphabet Alphabet, class Func>
+static inline std::size_t base64_encode(Func func, const uint8_t* src,
+                                        std::size_t size, uint8_t* out)
+{
+    return base64_encode(
+        func, Alphabet == alphabet::url ? tables::encode_url : tables::encode,
+        Alphabet == alphabet::url ? tables::encode_pairs_url
+                                  : tables::encode_pairs,
+        src, size, out);
+}
 }
 }
 }
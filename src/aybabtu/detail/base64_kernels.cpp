@@ -0,0 +1,195 @@
+// Copyright (c) Steinwurf ApS 2016.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include "base64_kernels.hpp"
+
+#include "base64_avx2.hpp"
+#include "base64_avx512.hpp"
+#include "base64_avx512bw.hpp"
+#include "base64_avx512vl.hpp"
+#include "base64_basic.hpp"
+#include "base64_neon.hpp"
+#include "base64_ssse3.hpp"
+
+#include "../version.hpp"
+
+#include <cpuid/cpuinfo.hpp>
+#include <platform/config.hpp>
+
+#include <cassert>
+#include <cstdint>
+
+namespace aybabtu
+{
+inline namespace STEINWURF_AYBABTU_VERSION
+{
+namespace detail
+{
+// Only the scalar, SSSE3 and AVX2 codecs can strip whitespace, validate
+// strings and encode in place. The AVX-512 codecs use the AVX2 code, which
+// every AVX-512 CPU supports, and the NEON codec uses the scalar code.
+template <class Codec, class Scan = Codec>
+static base64_kernels codec_kernels(simd simd)
+{
+    return base64_kernels{simd,
+                          {&Codec::encode, &Codec::encode_url},
+                          {&Codec::decode, &Codec::decode_url},
+                          &Codec::encode_custom,
+                          &Codec::decode_custom,
+                          &Scan::strip_whitespace,
+                          {&Scan::validate, &Scan::validate_url},
+                          &Scan::validate_custom,
+                          {&Scan::encode_inplace, &Scan::encode_inplace_url},
+                          &Scan::encode_inplace_custom,
+                          {&Codec::encode, &Codec::encode_url},
+                          {&Codec::decode, &Codec::decode_url}};
+}
+
+// The SSSE3, AVX2 and AVX-512 VBMI codecs also have loops with non-temporal
+// stores. The other AVX-512 codecs use the AVX2 loops.
+template <class Codec, class Scan = Codec, class Stream = Scan>
+static base64_kernels streaming_kernels(simd simd)
+{
+    base64_kernels kernels = codec_kernels<Codec, Scan>(simd);
+    kernels.encode_stream[0] = &Stream::encode_stream;
+    kernels.encode_stream[1] = &Stream::encode_stream_url;
+    kernels.decode_stream[0] = &Stream::decode_stream;
+    kernels.decode_stream[1] = &Stream::decode_stream_url;
+    return kernels;
+}
+
+// Whether an acceleration is compiled in and supported by the CPU. The
+// AVX-512 codecs also use the AVX2 code, which every AVX-512BW CPU supports.
+static bool is_supported(simd simd, const cpuid::cpuinfo& cpuinfo)
+{
+    switch (simd)
+    {
+    case simd::auto_:
+    case simd::none:
+        return true;
+#if defined(PLATFORM_X86)
+    case simd::ssse3:
+        return base64_ssse3::is_compiled() && cpuinfo.has_ssse3();
+    case simd::avx2:
+        return base64_avx2::is_compiled() && cpuinfo.has_avx2();
+    case simd::avx512_vbmi:
+        return base64_avx512::is_compiled() && cpuinfo.has_avx512_vbmi() &&
+               cpuinfo.has_avx512_bw();
+    case simd::avx512_bw:
+        return base64_avx512bw::is_compiled() && cpuinfo.has_avx512_bw();
+    case simd::avx512_vl:
+        return base64_avx512vl::is_compiled() && cpuinfo.has_avx512_bw() &&
+               cpuinfo.has_avx512_vl();
+#elif defined(PLATFORM_ARM)
+    case simd::neon:
+        return base64_neon::is_compiled() && cpuinfo.has_neon();
+#endif
+    default:
+        return false;
+    }
+}
+
+// simd::auto_ selects the first supported codec in the order below, which
+// leaves out the AVX-512VL codec, as it is slower than the AVX-512BW one.
+static base64_kernels make_kernels(simd simd, const cpuid::cpuinfo& cpuinfo)
+{
+#if defined(PLATFORM_X86)
+    if ((simd == simd::auto_ && is_supported(simd::avx512_vbmi, cpuinfo)) ||
+        simd == simd::avx512_vbmi)
+    {
+        return streaming_kernels<base64_avx512, base64_avx2, base64_avx512>(
+            simd::avx512_vbmi);
+    }
+    if ((simd == simd::auto_ && is_supported(simd::avx512_bw, cpuinfo)) ||
+        simd == simd::avx512_bw)
+    {
+        return streaming_kernels<base64_avx512bw, base64_avx2>(
+            simd::avx512_bw);
+    }
+    if (simd == simd::avx512_vl)
+    {
+        return streaming_kernels<base64_avx512vl, base64_avx2>(simd::avx512_vl);
+    }
+    if ((simd == simd::auto_ && is_supported(simd::avx2, cpuinfo)) ||
+        simd == simd::avx2)
+    {
+        return streaming_kernels<base64_avx2>(simd::avx2);
+    }
+    if ((simd == simd::auto_ && is_supported(simd::ssse3, cpuinfo)) ||
+        simd == simd::ssse3)
+    {
+        return streaming_kernels<base64_ssse3>(simd::ssse3);
+    }
+#elif defined(PLATFORM_ARM)
+    if ((simd == simd::auto_ && is_supported(simd::neon, cpuinfo)) ||
+        simd == simd::neon)
+    {
+        return codec_kernels<base64_neon, base64_basic>(simd::neon);
+    }
+#endif
+    (void)cpuinfo;
+    return codec_kernels<base64_basic>(simd::none);
+}
+
+// The kernels of every simd value, in declaration order.
+struct base64_kernels_table
+{
+    base64_kernels kernels[8];
+    bool supported[8];
+};
+
+// The table is only made once, so it is kept out of select, which would
+// otherwise save and restore the registers it uses on every call.
+#if defined(_MSC_VER)
+__declspec(noinline)
+#else
+__attribute__((noinline))
+#endif
+static base64_kernels_table make_table()
+{
+    const cpuid::cpuinfo cpuinfo{};
+
+    return base64_kernels_table{{make_kernels(simd::auto_, cpuinfo),
+                                 make_kernels(simd::none, cpuinfo),
+                                 make_kernels(simd::ssse3, cpuinfo),
+                                 make_kernels(simd::avx2, cpuinfo),
+                                 make_kernels(simd::neon, cpuinfo),
+                                 make_kernels(simd::avx512_vbmi, cpuinfo),
+                                 make_kernels(simd::avx512_bw, cpuinfo),
+                                 make_kernels(simd::avx512_vl, cpuinfo)},
+                                {is_supported(simd::auto_, cpuinfo),
+                                 is_supported(simd::none, cpuinfo),
+                                 is_supported(simd::ssse3, cpuinfo),
+                                 is_supported(simd::avx2, cpuinfo),
+                                 is_supported(simd::neon, cpuinfo),
+                                 is_supported(simd::avx512_vbmi, cpuinfo),
+                                 is_supported(simd::avx512_bw, cpuinfo),
+                                 is_supported(simd::avx512_vl, cpuinfo)}};
+}
+
+// Resolved on first use, which C++11 guarantees to be thread-safe. This also
+// defers the CPU detection until base64 is actually used.
+static const base64_kernels_table& table()
+{
+    static const base64_kernels_table table = make_table();
+    return table;
+}
+
+const base64_kernels& base64_kernels::select(aybabtu::simd simd)
+{
+    assert(static_cast<std::size_t>(simd) <
+           sizeof(table().kernels) / sizeof(table().kernels[0]));
+    return table().kernels[static_cast<std::size_t>(simd)];
+}
+
+bool base64_kernels::is_supported(aybabtu::simd simd)
+{
+    assert(static_cast<std::size_t>(simd) <
+           sizeof(table().supported) / sizeof(table().supported[0]));
+    return table().supported[static_cast<std::size_t>(simd)];
+}
+}
+}
+}
@@ -0,0 +1,115 @@
+// Copyright (c) Steinwurf ApS 2016.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include "../simd.hpp"
+#include "../version.hpp"
+
+#include <cstdint>
+#include <system_error>
+
+namespace aybabtu
+{
+inline namespace STEINWURF_AYBABTU_VERSION
+{
+namespace detail
+{
+/// The encode and decode functions of a single codec. The functions neither
+/// write nor accept padding, which is handled by the caller. On an invalid
+/// character the decode functions set the error and return the number of
+/// bytes decoded before the 4-character group holding it.
+struct base64_kernels
+{
+    using encode_function = std::size_t (*)(const uint8_t* src,
+                                            std::size_t size, uint8_t* out);
+
+    using decode_function = std::size_t (*)(const uint8_t* src,
+                                            std::size_t size, uint8_t* out,
+                                            std::error_code& error);
+
+    using encode_custom_function = std::size_t (*)(const uint8_t* src,
+                                                   std::size_t size,
+                                                   uint8_t* out,
+                                                   const uint8_t* table);
+
+    using decode_custom_function = std::size_t (*)(const uint8_t* src,
+                                                   std::size_t size,
+                                                   uint8_t* out,
+                                                   const uint8_t* table,
+                                                   std::error_code& error);
+
+    using strip_function = std::size_t (*)(const uint8_t* src,
+                                           std::size_t size, uint8_t* out);
+
+    using validate_function = bool (*)(const uint8_t* src, std::size_t size);
+
+    using validate_custom_function = bool (*)(const uint8_t* src,
+                                              std::size_t size,
+                                              const uint8_t* table);
+
+    using encode_inplace_function = std::size_t (*)(uint8_t* buffer,
+                                                    std::size_t size);
+
+    using encode_inplace_custom_function =
+        std::size_t (*)(uint8_t* buffer, std::size_t size,
+                        const uint8_t* table);
+
+    /// The acceleration implemented by the functions, never simd::auto_
+    aybabtu::simd simd;
+
+    /// The encode function of each alphabet, indexed by alphabet
+    encode_function encode[2];
+
+    /// The decode function of each alphabet, indexed by alphabet
+    decode_function decode[2];
+
+    /// The encode function for custom alphabets
+    encode_custom_function encode_custom;
+
+    /// The decode function for custom alphabets
+    decode_custom_function decode_custom;
+
+    /// The function that removes whitespace before decoding
+    strip_function strip_whitespace;
+
+    /// The function that checks a string without decoding it, indexed by
+    /// alphabet
+    validate_function validate[2];
+
+    /// The function that checks a string with a custom alphabet
+    validate_custom_function validate_custom;
+
+    /// The function that encodes a buffer into itself, indexed by alphabet
+    encode_inplace_function encode_inplace[2];
+
+    /// The function that encodes a buffer into itself with a custom alphabet
+    encode_inplace_custom_function encode_inplace_custom;
+
+    /// The encode function with non-temporal stores of each alphabet,
+    /// indexed by alphabet. Codecs without them use their encode functions.
+    encode_function encode_stream[2];
+
+    /// The decode function with non-temporal stores of each alphabet,
+    /// indexed by alphabet. Codecs without them use their decode functions.
+    decode_function decode_stream[2];
+
+    /// Select the kernels for an acceleration. The kernels for every
+    /// acceleration, including the CPU detection needed for simd::auto_, are
+    /// resolved once on the first call, so subsequent calls are a table
+    /// lookup.
+    ///
+    /// @param simd the requested simd instruction set
+    /// @return the kernels to use
+    static const base64_kernels& select(aybabtu::simd simd);
+
+    /// @param simd the simd instruction set
+    /// @return whether the instruction set is compiled in and supported by
+    ///         the CPU, see base64::is_supported()
+    static bool is_supported(aybabtu::simd simd);
+};
+}
+}
+}
@@ -87,9 +87,17 @@ const uint8x16_t enc_translate_lut = {65U,  71U,  252U, 252U, 252U, 252U,
                                       252U, 252U, 252U, 252U, 252U, 252U,
                                       237U, 240U, 0U,   0U};
 
+// The same for the url alphabet, which maps range #3 to '-' and range #4 to
+// '_':
+const uint8x16_t enc_translate_lut_url = {65U,  71U,  252U, 252U, 252U, 252U,
+                                          252U, 252U, 252U, 252U, 252U, 252U,
+                                          239U, 32U,  0U,   0U};
+
+template <alphabet Alphabet>
 static inline uint8x16x4_t enc_translate(const uint8x16x4_t in)
 {
-
+    const uint8x16_t lut = Alphabet == alphabet::url ? enc_translate_lut_url
+                                                     : enc_translate_lut;
     const uint8x16_t offset = vdupq_n_u8(51);
 
     uint8x16x4_t indices, mask, delta, out;
@@ -123,10 +131,10 @@ static inline uint8x16x4_t enc_translate(const uint8x16x4_t in)
     indices.val[3] = vsubq_u8(indices.val[3], mask.val[3]);
 
     // Lookup delta values:
-    delta.val[0] = vqtbl1q_u8(enc_translate_lut, indices.val[0]);
-    delta.val[1] = vqtbl1q_u8(enc_translate_lut, indices.val[1]);
-    delta.val[2] = vqtbl1q_u8(enc_translate_lut, indices.val[2]);
-    delta.val[3] = vqtbl1q_u8(enc_translate_lut, indices.val[3]);
+    delta.val[0] = vqtbl1q_u8(lut, indices.val[0]);
+    delta.val[1] = vqtbl1q_u8(lut, indices.val[1]);
+    delta.val[2] = vqtbl1q_u8(lut, indices.val[2]);
+    delta.val[3] = vqtbl1q_u8(lut, indices.val[3]);
 
     // Add delta values:
     out.val[0] = vaddq_u8(in.val[0], delta.val[0]);
@@ -137,6 +145,7 @@ static inline uint8x16x4_t enc_translate(const uint8x16x4_t in)
     return out;
 }
 
+template <alphabet Alphabet>
 static inline void encode_loop_neon(const uint8_t** src, std::size_t& remaining,
                                     uint8_t** out, std::size_t& written)
 {
@@ -154,7 +163,7 @@ static inline void encode_loop_neon(const uint8_t** src, std::size_t& remaining,
         uint8x16x4_t neon_out = enc_reshuffle(neon_src);
 
         // Translate reshuffled bytes to the Base64 alphabet:
-        neon_out = enc_translate(neon_out);
+        neon_out = enc_translate<Alphabet>(neon_out);
 
         // Interleave and store output:
         vst4q_u8(*out, neon_out);
@@ -178,11 +187,20 @@ static inline int is_nonzero(const uint8x16_t v)
 const uint8x8_t delta_lookup_lut = {
     0, 16, 19, 4, (uint8_t)-65, (uint8_t)-65, (uint8_t)-71, (uint8_t)-71,
 };
+
+const uint8x8_t delta_lookup_lut_url = {
+    (uint8_t)-32, 0,           17,          4,
+    (uint8_t)-65, (uint8_t)-65, (uint8_t)-71, (uint8_t)-71,
+};
+
+template <alphabet Alphabet>
 static inline uint8x16_t delta_lookup(const uint8x16_t v)
 {
+    const uint8x8_t lut = Alphabet == alphabet::url ? delta_lookup_lut_url
+                                                    : delta_lookup_lut;
 
-    return vcombine_u8(vtbl1_u8(delta_lookup_lut, vget_low_u8(v)),
-                       vtbl1_u8(delta_lookup_lut, vget_high_u8(v)));
+    return vcombine_u8(vtbl1_u8(lut, vget_low_u8(v)),
+                       vtbl1_u8(lut, vget_high_u8(v)));
 }
 
 const uint8x16_t lane_lut_lo = {0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
@@ -190,25 +208,44 @@ const uint8x16_t lane_lut_lo = {0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
 
 const uint8x16_t lane_lut_hi = {0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
                                 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10};
+
+// See the SSSE3 decoder for the url alphabet lookup tables:
+const uint8x16_t lane_lut_lo_url = {0x15, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                    0x11, 0x11, 0x11, 0x11, 0x13, 0x3B,
+                                    0x3B, 0x3A, 0x3B, 0x33};
+
+const uint8x16_t lane_lut_hi_url = {0x10, 0x10, 0x01, 0x02, 0x04, 0x08,
+                                    0x04, 0x20, 0x10, 0x10, 0x10, 0x10,
+                                    0x10, 0x10, 0x10, 0x10};
+
+template <alphabet Alphabet>
 static inline uint8x16_t dec_loop_neon32_lane(uint8x16_t* lane)
 {
     // See the SSSE3 decoder for an explanation of the algorithm.
     const uint8x16_t mask_0F = vdupq_n_u8(0x0F);
-    const uint8x16_t mask_2F = vdupq_n_u8(0x2F);
 
     const uint8x16_t hi_nibbles = vshrq_n_u8(*lane, 4);
     const uint8x16_t lo_nibbles = vandq_u8(*lane, mask_0F);
-    const uint8x16_t eq_2F = vceqq_u8(*lane, mask_2F);
 
-    const uint8x16_t hi = vqtbl1q_u8(lane_lut_hi, hi_nibbles);
-    const uint8x16_t lo = vqtbl1q_u8(lane_lut_lo, lo_nibbles);
+    const uint8x16_t hi = vqtbl1q_u8(
+        Alphabet == alphabet::url ? lane_lut_hi_url : lane_lut_hi, hi_nibbles);
+    const uint8x16_t lo = vqtbl1q_u8(
+        Alphabet == alphabet::url ? lane_lut_lo_url : lane_lut_lo, lo_nibbles);
+
+    // Subtract 1 from the index of the '/' characters, or move the '_'
+    // characters to index 0:
+    const uint8x16_t index =
+        Alphabet == alphabet::url
+            ? vqsubq_u8(hi_nibbles, vceqq_u8(*lane, vdupq_n_u8(0x5F)))
+            : vaddq_u8(vceqq_u8(*lane, vdupq_n_u8(0x2F)), hi_nibbles);
 
     // Now simply add the delta values to the input:
-    *lane = vaddq_u8(*lane, delta_lookup(vaddq_u8(eq_2F, hi_nibbles)));
+    *lane = vaddq_u8(*lane, delta_lookup<Alphabet>(index));
 
     // Return the validity mask:
     return vandq_u8(lo, hi);
 }
+template <alphabet Alphabet>
 static inline void decode_loop_neon(const uint8_t** src, std::size_t& remaining,
                                     uint8_t** out, std::size_t& written)
 {
@@ -229,10 +266,11 @@ static inline void decode_loop_neon(const uint8_t** src, std::size_t& remaining,
         uint8x16x4_t str = vld4q_u8(*src);
 
         // Decode each lane, collect a mask of invalid inputs:
-        const uint8x16_t classified = dec_loop_neon32_lane(&str.val[0]) |
-                                      dec_loop_neon32_lane(&str.val[1]) |
-                                      dec_loop_neon32_lane(&str.val[2]) |
-                                      dec_loop_neon32_lane(&str.val[3]);
+        const uint8x16_t classified =
+            dec_loop_neon32_lane<Alphabet>(&str.val[0]) |
+            dec_loop_neon32_lane<Alphabet>(&str.val[1]) |
+            dec_loop_neon32_lane<Alphabet>(&str.val[2]) |
+            dec_loop_neon32_lane<Alphabet>(&str.val[3]);
 
         // Check for invalid input: if any of the delta values are
         // zero, fall back on bytewise code to do error checking and
@@ -262,16 +300,196 @@ static inline void decode_loop_neon(const uint8_t** src, std::size_t& remaining,
     }
 }
 
+// A custom alphabet has no ranges of consecutive characters to exploit, so
+// the translation is a plain table lookup. NEON64 can look up 64 bytes at a
+// time with `vqtbl4q_u8`, which covers the whole encode table and half of the
+// ASCII part of the decode table. NEON32 has no such lookup, so there custom
+// alphabets are left to the bytewise code.
+static inline uint8x16x4_t load_table(const uint8_t* table)
+{
+    uint8x16x4_t lut;
+    lut.val[0] = vld1q_u8(table);
+    lut.val[1] = vld1q_u8(table + 16);
+    lut.val[2] = vld1q_u8(table + 32);
+    lut.val[3] = vld1q_u8(table + 48);
+    return lut;
+}
+
+static inline void encode_loop_neon_custom(const uint8_t** src,
+                                           std::size_t& remaining,
+                                           uint8_t** out, std::size_t& written,
+                                           const uint8_t* table)
+{
+#if defined(__arm64__) || defined(__aarch64__)
+    std::size_t rounds = remaining / 48;
+
+    remaining -= rounds * 48; // 48 bytes consumed per round
+    written += rounds * 64;   // 64 bytes produced per round
+
+    const uint8x16x4_t lut = load_table(table);
+
+    while (rounds > 0)
+    {
+        // Load 48 bytes and deinterleave:
+        uint8x16x3_t neon_src = vld3q_u8(*src);
+
+        // Reshuffle and translate:
+        uint8x16x4_t neon_out = enc_reshuffle(neon_src);
+        neon_out.val[0] = vqtbl4q_u8(lut, neon_out.val[0]);
+        neon_out.val[1] = vqtbl4q_u8(lut, neon_out.val[1]);
+        neon_out.val[2] = vqtbl4q_u8(lut, neon_out.val[2]);
+        neon_out.val[3] = vqtbl4q_u8(lut, neon_out.val[3]);
+
+        // Interleave and store output:
+        vst4q_u8(*out, neon_out);
+
+        *src += 48;
+        *out += 64;
+        rounds--;
+    }
+#else
+    (void)src;
+    (void)remaining;
+    (void)out;
+    (void)written;
+    (void)table;
+#endif
+}
+
+#if defined(__arm64__) || defined(__aarch64__)
+static inline uint8x16_t dec_loop_neon_custom_lane(const uint8x16x4_t& lut_lo,
+                                                   const uint8x16x4_t& lut_hi,
+                                                   uint8x16_t* lane)
+{
+    // Characters below 64 are found in the first lookup. The second lookup
+    // is offset by 64, so it leaves those characters alone and replaces the
+    // ones from 64 to 127. Characters above 127 are out of range of both
+    // lookups and are left as zero:
+    const uint8x16_t values =
+        vqtbx4q_u8(vqtbl4q_u8(lut_lo, *lane), lut_hi,
+                   vsubq_u8(*lane, vdupq_n_u8(64)));
+
+    // Invalid characters have the most significant bit set in values,
+    // non-ASCII characters in the input. Return it as the validity mask:
+    const uint8x16_t invalid = vshrq_n_u8(vorrq_u8(values, *lane), 7);
+
+    *lane = values;
+    return invalid;
+}
+#endif
+
+static inline void decode_loop_neon_custom(const uint8_t** src,
+                                           std::size_t& remaining,
+                                           uint8_t** out, std::size_t& written,
+                                           const uint8_t* table)
+{
+#if defined(__arm64__) || defined(__aarch64__)
+    if (remaining < 64)
+    {
+        return;
+    }
+
+    // See decode_loop_neon for the bounds:
+    std::size_t rounds = remaining / 64;
+
+    const uint8x16x4_t lut_lo = load_table(table);
+    const uint8x16x4_t lut_hi = load_table(table + 64);
+
+    while (rounds > 0)
+    {
+        // Load 64 bytes and deinterleave:
+        uint8x16x4_t str = vld4q_u8(*src);
+
+        // Decode each lane, collect a mask of invalid inputs:
+        const uint8x16_t classified =
+            dec_loop_neon_custom_lane(lut_lo, lut_hi, &str.val[0]) |
+            dec_loop_neon_custom_lane(lut_lo, lut_hi, &str.val[1]) |
+            dec_loop_neon_custom_lane(lut_lo, lut_hi, &str.val[2]) |
+            dec_loop_neon_custom_lane(lut_lo, lut_hi, &str.val[3]);
+
+        if (is_nonzero(classified))
+        {
+            break;
+        }
+
+        remaining -= 64; // 64 bytes consumed per round
+        written += 48;   // 48 bytes produced per round
+
+        uint8x16x3_t dec;
+        // Compress four bytes into three:
+        dec.val[0] =
+            vorrq_u8(vshlq_n_u8(str.val[0], 2), vshrq_n_u8(str.val[1], 4));
+        dec.val[1] =
+            vorrq_u8(vshlq_n_u8(str.val[1], 4), vshrq_n_u8(str.val[2], 2));
+        dec.val[2] = vorrq_u8(vshlq_n_u8(str.val[2], 6), str.val[3]);
+
+        // Interleave and store decoded result:
+        vst3q_u8(*out, dec);
+
+        *src += 64;
+        *out += 48;
+        --rounds;
+    }
+#else
+    (void)src;
+    (void)remaining;
+    (void)out;
+    (void)written;
+    (void)table;
+#endif
+}
+
 std::size_t base64_neon::encode(const uint8_t* src, std::size_t size,
                                 uint8_t* out)
 {
-    return base64_encode(&encode_loop_neon, src, size, out);
+    return base64_encode<alphabet::standard>(
+        &encode_loop_neon<alphabet::standard>, src, size, out);
 }
 
 std::size_t base64_neon::decode(const uint8_t* src, std::size_t size,
                                 uint8_t* out, std::error_code& error)
 {
-    return base64_decode(&decode_loop_neon, src, size, out, error);
+    return base64_decode<alphabet::standard>(
+        &decode_loop_neon<alphabet::standard>, src, size, out, error);
+}
+
+std::size_t base64_neon::encode_url(const uint8_t* src, std::size_t size,
+                                    uint8_t* out)
+{
+    return base64_encode<alphabet::url>(
+        &encode_loop_neon<alphabet::url>, src, size, out);
+}
+
+std::size_t base64_neon::decode_url(const uint8_t* src, std::size_t size,
+                                    uint8_t* out, std::error_code& error)
+{
+    return base64_decode<alphabet::url>(
+        &decode_loop_neon<alphabet::url>, src, size, out, error);
+}
+
+std::size_t base64_neon::encode_custom(const uint8_t* src, std::size_t size,
+                                       uint8_t* out, const uint8_t* table)
+{
+    return base64_encode(
+        [table](const uint8_t** src_it, std::size_t& remaining,
+                uint8_t** out_it, std::size_t& written)
+        {
+            encode_loop_neon_custom(src_it, remaining, out_it, written, table);
+        },
+        table, src, size, out);
+}
+
+std::size_t base64_neon::decode_custom(const uint8_t* src, std::size_t size,
+                                       uint8_t* out, const uint8_t* table,
+                                       std::error_code& error)
+{
+    return base64_decode(
+        [table](const uint8_t** src_it, std::size_t& remaining,
+                uint8_t** out_it, std::size_t& written)
+        {
+            decode_loop_neon_custom(src_it, remaining, out_it, written, table);
+        },
+        table, src, size, out, error);
 }
 
 bool base64_neon::is_compiled()
@@ -294,6 +512,37 @@ std::size_t base64_neon::decode(const uint8_t*, std::size_t, uint8_t*,
     return 0;
 }
 
+std::size_t base64_neon::encode_url(const uint8_t*, std::size_t, uint8_t*)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_neon::decode_url(const uint8_t*, std::size_t, uint8_t*,
+                                    std::error_code&)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_neon::encode_custom(const uint8_t*, std::size_t, uint8_t*,
+                                       const uint8_t*)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_neon::decode_custom(const uint8_t*, std::size_t, uint8_t*,
+                                       const uint8_t*, std::error_code&)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
 bool base64_neon::is_compiled()
 {
     return false;
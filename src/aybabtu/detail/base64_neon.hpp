@@ -18,12 +18,31 @@ namespace detail
 {
 struct base64_neon
 {
+    /// Encode with the standard alphabet, without padding
     static std::size_t encode(const uint8_t* src, std::size_t size,
                               uint8_t* out);
 
+    /// Decode with the standard alphabet, without padding
     static std::size_t decode(const uint8_t* src, std::size_t size,
                               uint8_t* out, std::error_code& error);
 
+    /// Encode with the URL and filename safe alphabet, without padding
+    static std::size_t encode_url(const uint8_t* src, std::size_t size,
+                                  uint8_t* out);
+
+    /// Decode with the URL and filename safe alphabet, without padding
+    static std::size_t decode_url(const uint8_t* src, std::size_t size,
+                                  uint8_t* out, std::error_code& error);
+
+    /// Encode with a custom alphabet, without padding
+    static std::size_t encode_custom(const uint8_t* src, std::size_t size,
+                                     uint8_t* out, const uint8_t* table);
+
+    /// Decode with a custom alphabet, without padding
+    static std::size_t decode_custom(const uint8_t* src, std::size_t size,
+                                     uint8_t* out, const uint8_t* table,
+                                     std::error_code& error);
+
     /// @return whether this cpu acceralation is compiled or not
     static bool is_compiled();
 };
@@ -7,6 +7,10 @@
 #include "../version.hpp"
 #include "base64_decode.hpp"
 #include "base64_encode.hpp"
+#include "base64_validate.hpp"
+#include "ssse3_loops.hpp"
+#include "strip_whitespace.hpp"
+#include "tables.hpp"
 
 #include <platform/config.hpp>
 
@@ -28,229 +32,295 @@ namespace detail
 {
 #ifdef PLATFORM_SSSE3
 
-// This code borrows from code from Alfred Klomp's library
-// https://github.com/aklomp/base64 (published under BSD)
-// The code has been modified to fit the aybabtu library.
-static inline __m128i enc_reshuffle(__m128i in)
-{
-    // Input, bytes MSB to LSB:
-    // 0 0 0 0 l k j i h g f e d c b a
-
-    in = _mm_shuffle_epi8(
-        in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
-    // in, bytes MSB to LSB:
-    // k l j k
-    // h i g h
-    // e f d e
-    // b c a b
-
-    const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00));
-    // bits, upper case are most significant bits, lower case are least
-    // significant bits 0000kkkk LL000000 JJJJJJ00 00000000 0000hhhh II000000
-    // GGGGGG00 00000000 0000eeee FF000000 DDDDDD00 00000000 0000bbbb CC000000
-    // AAAAAA00 00000000
-
-    const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
-    // 00000000 00kkkkLL 00000000 00JJJJJJ
-    // 00000000 00hhhhII 00000000 00GGGGGG
-    // 00000000 00eeeeFF 00000000 00DDDDDD
-    // 00000000 00bbbbCC 00000000 00AAAAAA
-
-    const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003F03F0));
-    // 00000000 00llllll 000000jj KKKK0000
-    // 00000000 00iiiiii 000000gg HHHH0000
-    // 00000000 00ffffff 000000dd EEEE0000
-    // 00000000 00cccccc 000000aa BBBB0000
-
-    const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
-    // 00llllll 00000000 00jjKKKK 00000000
-    // 00iiiiii 00000000 00ggHHHH 00000000
-    // 00ffffff 00000000 00ddEEEE 00000000
-    // 00cccccc 00000000 00aaBBBB 00000000
-
-    return _mm_or_si128(t1, t3);
-    // 00llllll 00kkkkLL 00jjKKKK 00JJJJJJ
-    // 00iiiiii 00hhhhII 00ggHHHH 00GGGGGG
-    // 00ffffff 00eeeeFF 00ddEEEE 00DDDDDD
-    // 00cccccc 00bbbbCC 00aaBBBB 00AAAAAA
-}
-static inline __m128i enc_translate(const __m128i in)
-{
-    // A lookup table containing the absolute offsets for all ranges:
-    const __m128i lut = _mm_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4, -4, -4,
-                                      -4, -4, -19, -16, 0, 0);
-
-    // Translate values 0..63 to the Base64 alphabet. There are five sets:
-    // #  From      To         Abs    Index  Characters
-    // 0  [0..25]   [65..90]   +65        0  ABCDEFGHIJKLMNOPQRSTUVWXYZ
-    // 1  [26..51]  [97..122]  +71        1  abcdefghijklmnopqrstuvwxyz
-    // 2  [52..61]  [48..57]    -4  [2..11]  0123456789
-    // 3  [62]      [43]       -19       12  +
-    // 4  [63]      [47]       -16       13  /
-
-    // Create LUT indices from the input. The index for range #0 is right,
-    // others are 1 less than expected:
-    __m128i indices = _mm_subs_epu8(in, _mm_set1_epi8(51));
-
-    // mask is 0xFF (-1) for range #[1..4] and 0x00 for range #0:
-    __m128i mask = _mm_cmpgt_epi8(in, _mm_set1_epi8(25));
-
-    // Subtract -1, so add 1 to indices for range #[1..4]. All indices are
-    // now correct:
-    indices = _mm_sub_epi8(indices, mask);
-
-    // Add offsets to input values:
-    return _mm_add_epi8(in, _mm_shuffle_epi8(lut, indices));
-}
-static inline void encode_loop_ssse3(const uint8_t** src,
-                                     std::size_t& remaining, uint8_t** out,
-                                     std::size_t& written)
-{
-    if (remaining < 16)
-    {
-        return;
-    }
+// Whitespace is stripped 16 bytes at a time. Blocks without whitespace are
+// stored as they are, otherwise the two 8-byte halves are packed with pshufb,
+// using a table of indices for every 8-bit mask of bytes to keep.
 
-    // Process blocks of 12 bytes at a time. Because blocks are loaded 16
-    // bytes at a time, ensure that there will be at least 4 remaining
-    // bytes after the last round, so that the final read will not pass
-    // beyond the bounds of the input buffer:
-    size_t rounds = (remaining - 4) / 12;
+static inline uint32_t keep_mask(const __m128i str)
+{
+    // Whitespace is ' ' or one of the control characters from '\t' to '\r':
+    const __m128i offset = _mm_sub_epi8(str, _mm_set1_epi8('\t'));
+    const __m128i control =
+        _mm_cmpeq_epi8(_mm_min_epu8(offset, _mm_set1_epi8(4)), offset);
+    const __m128i space = _mm_cmpeq_epi8(str, _mm_set1_epi8(' '));
 
-    while (rounds > 0)
-    {
-        // Load input:
-        __m128i str = _mm_loadu_si128((__m128i*)*src);
+    return ~_mm_movemask_epi8(_mm_or_si128(control, space)) & 0xFFFF;
+}
 
-        // Reshuffle:
-        str = enc_reshuffle(str);
+static inline std::size_t popcount8(uint32_t x)
+{
+    x = x - ((x >> 1) & 0x55);
+    x = (x & 0x33) + ((x >> 2) & 0x33);
+    return (x + (x >> 4)) & 0x0F;
+}
 
-        // Translate reshuffled bytes to the Base64 alphabet:
-        str = enc_translate(str);
+// Pack the bytes selected by keep to the front of out. Always writes 16
+// bytes, but only the returned number of bytes are valid.
+static inline std::size_t compress(const __m128i str, uint32_t keep,
+                                   uint8_t* out)
+{
+    const uint32_t lo = keep & 0xFF;
+    const uint32_t hi = keep >> 8;
 
-        // Store:
-        _mm_storeu_si128((__m128i*)*out, str);
+    // The indices of the upper half are offset by 8:
+    const __m128i shuffle = _mm_add_epi8(
+        _mm_unpacklo_epi64(
+            _mm_loadl_epi64((const __m128i*)(tables::compress + lo * 8)),
+            _mm_loadl_epi64((const __m128i*)(tables::compress + hi * 8))),
+        _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8));
 
-        *src += 12;
-        *out += 16;
-        remaining -= 12; // 12 bytes consumed per round
-        written += 16;   // 16 bytes produced per round
+    const __m128i packed = _mm_shuffle_epi8(str, shuffle);
+    const std::size_t lo_count = popcount8(lo);
 
-        rounds--;
-    }
+    _mm_storel_epi64((__m128i*)out, packed);
+    _mm_storel_epi64((__m128i*)(out + lo_count), _mm_srli_si128(packed, 8));
+
+    return lo_count + popcount8(hi);
 }
 
-static inline __m128i dec_reshuffle(const __m128i in)
+static inline void strip_loop_ssse3(const uint8_t** src,
+                                    std::size_t& remaining, uint8_t** out,
+                                    std::size_t& written)
 {
-    // in, bits, upper case are most significant bits, lower case
-    // are least significant bits
-    // 00llllll 00kkkkLL 00jjKKKK 00JJJJJJ
-    // 00iiiiii 00hhhhII 00ggHHHH 00GGGGGG
-    // 00ffffff 00eeeeFF 00ddEEEE 00DDDDDD
-    // 00cccccc 00bbbbCC 00aaBBBB 00AAAAAA
+    // The output never gets ahead of the input, so the 16 bytes written per
+    // round stay within the size of the input:
+    while (remaining >= 16)
+    {
+        const __m128i str = _mm_loadu_si128((__m128i*)*src);
+        const uint32_t keep = keep_mask(str);
 
-    const __m128i merge_ab_and_bc =
-        _mm_maddubs_epi16(in, _mm_set1_epi32(0x01400140));
-    // 0000kkkk LLllllll 0000JJJJ JJjjKKKK
-    // 0000hhhh IIiiiiii 0000GGGG GGggHHHH
-    // 0000eeee FFffffff 0000DDDD DDddEEEE
-    // 0000bbbb CCcccccc 0000AAAA AAaaBBBB
+        std::size_t count = 16;
+        if (keep == 0xFFFF)
+        {
+            _mm_storeu_si128((__m128i*)*out, str);
+        }
+        else
+        {
+            count = compress(str, keep, *out);
+        }
 
-    const __m128i out =
-        _mm_madd_epi16(merge_ab_and_bc, _mm_set1_epi32(0x00011000));
-    // 00000000 JJJJJJjj KKKKkkkk LLllllll
-    // 00000000 GGGGGGgg HHHHhhhh IIiiiiii
-    // 00000000 DDDDDDdd EEEEeeee FFffffff
-    // 00000000 AAAAAAaa BBBBbbbb CCcccccc
+        *src += 16;
+        *out += count;
+        remaining -= 16;
+        written += count;
+    }
+}
 
-    // Pack bytes together:
-    return _mm_shuffle_epi8(out, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14,
-                                               13, 12, -1, -1, -1, -1));
-    // 00000000 00000000 00000000 00000000
-    // LLllllll KKKKkkkk JJJJJJjj IIiiiiii
-    // HHHHhhhh GGGGGGgg FFffffff EEEEeeee
-    // DDDDDDdd CCcccccc BBBBbbbb AAAAAAaa
+// The streaming loops write the output with non-temporal stores, which
+// bypass the caches for inputs much larger than them. These stores must be
+// aligned, so the output is first aligned a group at a time. The decoder
+// packs the 12 bytes of four blocks into three whole vectors. The streaming
+// stores are followed by an sfence, so that they are ordered before the
+// normal stores of the rest and of the caller.
+
+template <alphabet Alphabet>
+static inline void encode_stream_ssse3(const uint8_t** src,
+                                       std::size_t& remaining, uint8_t** out,
+                                       std::size_t& written)
+{
+    if (remaining >= 64 &&
+        encode_align(Alphabet == alphabet::url ? tables::encode_url
+                                               : tables::encode,
+                     src, remaining, out, written, 16))
+    {
+        // Blocks are loaded 16 bytes at a time, see encode_loop_ssse3:
+        while (remaining >= 16)
+        {
+            __m128i str = _mm_loadu_si128((__m128i*)*src);
+            str = enc_translate<Alphabet>(enc_reshuffle(str));
+            _mm_stream_si128((__m128i*)*out, str);
+
+            *src += 12;
+            *out += 16;
+            remaining -= 12;
+            written += 16;
+        }
+        _mm_sfence();
+    }
+    encode_ssse3<Alphabet>(src, remaining, out, written);
 }
 
-static inline void decode_loop_ssse3(const uint8_t** src,
-                                     std::size_t& remaining, uint8_t** out,
-                                     std::size_t& written)
+template <alphabet Alphabet>
+static inline void decode_stream_ssse3(const uint8_t** src,
+                                       std::size_t& remaining, uint8_t** out,
+                                       std::size_t& written)
 {
-    if (remaining < 24)
+    if (remaining >= 128 &&
+        decode_align(Alphabet == alphabet::url ? tables::decode_shifted_url
+                                               : tables::decode_shifted,
+                     src, remaining, out, written, 16))
     {
-        return;
+        while (remaining >= 64)
+        {
+            __m128i a = _mm_loadu_si128((__m128i*)*src);
+            __m128i b = _mm_loadu_si128((__m128i*)(*src + 16));
+            __m128i c = _mm_loadu_si128((__m128i*)(*src + 32));
+            __m128i d = _mm_loadu_si128((__m128i*)(*src + 48));
+
+            // Leave invalid input to the normal loops:
+            if (dec_any_invalid(
+                    _mm_or_si128(_mm_or_si128(dec_classify<Alphabet>(a),
+                                              dec_classify<Alphabet>(b)),
+                                 _mm_or_si128(dec_classify<Alphabet>(c),
+                                              dec_classify<Alphabet>(d)))))
+            {
+                break;
+            }
+
+            // The last 4 bytes of every reshuffled block are zero:
+            a = dec_reshuffle(dec_roll<Alphabet>(a));
+            b = dec_reshuffle(dec_roll<Alphabet>(b));
+            c = dec_reshuffle(dec_roll<Alphabet>(c));
+            d = dec_reshuffle(dec_roll<Alphabet>(d));
+            _mm_stream_si128((__m128i*)*out,
+                             _mm_or_si128(a, _mm_slli_si128(b, 12)));
+            _mm_stream_si128(
+                (__m128i*)(*out + 16),
+                _mm_or_si128(_mm_srli_si128(b, 4), _mm_slli_si128(c, 8)));
+            _mm_stream_si128(
+                (__m128i*)(*out + 32),
+                _mm_or_si128(_mm_srli_si128(c, 8), _mm_slli_si128(d, 4)));
+
+            *src += 64;
+            *out += 48;
+            remaining -= 64;
+            written += 48;
+        }
+        _mm_sfence();
     }
+    decode_ssse3<Alphabet>(src, remaining, out, written);
+}
 
-    // Process blocks of 16 bytes per round. Because 4 extra zero bytes are
-    // written after the output, ensure that there will be at least 8 bytes
-    // of input data left to cover the gap. (6 data bytes and up to two
-    // end-of-string markers.)
-    size_t rounds = (remaining - 8) / 16;
+std::size_t base64_ssse3::encode(const uint8_t* src, std::size_t size,
+                                 uint8_t* out)
+{
+    return base64_encode<alphabet::standard>(
+        &encode_ssse3<alphabet::standard>, src, size, out);
+}
 
-    const __m128i lut_lo =
-        _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-                      0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+std::size_t base64_ssse3::decode(const uint8_t* src, std::size_t size,
+                                 uint8_t* out, std::error_code& error)
+{
+    return base64_decode<alphabet::standard>(
+        &decode_ssse3<alphabet::standard>, src, size, out, error);
+}
 
-    const __m128i lut_hi =
-        _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10,
-                      0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+std::size_t base64_ssse3::encode_url(const uint8_t* src, std::size_t size,
+                                     uint8_t* out)
+{
+    return base64_encode<alphabet::url>(
+        &encode_ssse3<alphabet::url>, src, size, out);
+}
 
-    const __m128i lut_roll =
-        _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+std::size_t base64_ssse3::decode_url(const uint8_t* src, std::size_t size,
+                                     uint8_t* out, std::error_code& error)
+{
+    return base64_decode<alphabet::url>(
+        &decode_ssse3<alphabet::url>, src, size, out, error);
+}
 
-    const __m128i mask_2F = _mm_set1_epi8(0x2F);
+std::size_t base64_ssse3::encode_custom(const uint8_t* src, std::size_t size,
+                                        uint8_t* out, const uint8_t* table)
+{
+    return base64_encode(
+        [table](const uint8_t** src_it, std::size_t& remaining,
+                uint8_t** out_it, std::size_t& written)
+        {
+            encode_ssse3_custom(src_it, remaining, out_it, written, table);
+        },
+        table, src, size, out);
+}
 
-    while (rounds > 0)
-    {
-        // Load input:
-        __m128i str = _mm_loadu_si128((__m128i*)*src);
-
-        // Table lookups:
-        const __m128i hi_nibbles =
-            _mm_and_si128(_mm_srli_epi32(str, 4), mask_2F);
-        const __m128i lo_nibbles = _mm_and_si128(str, mask_2F);
-        const __m128i hi = _mm_shuffle_epi8(lut_hi, hi_nibbles);
-        const __m128i lo = _mm_shuffle_epi8(lut_lo, lo_nibbles);
-
-        // Check for invalid input: if any "and" values from lo and hi are not
-        // zero, fall back on bytewise code to do error checking and reporting:
-        if (_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_and_si128(lo, hi),
-                                             _mm_setzero_si128())) != 0)
+std::size_t base64_ssse3::decode_custom(const uint8_t* src, std::size_t size,
+                                        uint8_t* out, const uint8_t* table,
+                                        std::error_code& error)
+{
+    return base64_decode(
+        [table](const uint8_t** src_it, std::size_t& remaining,
+                uint8_t** out_it, std::size_t& written)
         {
-            continue;
-        }
+            decode_ssse3_custom(src_it, remaining, out_it, written, table);
+        },
+        table, src, size, out, error);
+}
 
-        const __m128i eq_2F = _mm_cmpeq_epi8(str, mask_2F);
-        const __m128i roll =
-            _mm_shuffle_epi8(lut_roll, _mm_add_epi8(eq_2F, hi_nibbles));
+bool base64_ssse3::validate(const uint8_t* src, std::size_t size)
+{
+    return base64_validate(&validate_ssse3<alphabet::standard>, tables::decode,
+                           src, size);
+}
 
-        // Now simply add the delta values to the input:
-        str = _mm_add_epi8(str, roll);
+bool base64_ssse3::validate_url(const uint8_t* src, std::size_t size)
+{
+    return base64_validate(&validate_ssse3<alphabet::url>, tables::decode_url,
+                           src, size);
+}
 
-        // Reshuffle the input to packed 12-byte output format:
-        str = dec_reshuffle(str);
+bool base64_ssse3::validate_custom(const uint8_t* src, std::size_t size,
+                                   const uint8_t* table)
+{
+    return base64_validate(
+        [table](const uint8_t** src, std::size_t& remaining)
+        { return validate_ssse3_custom(src, remaining, table); },
+        table, src, size);
+}
 
-        // Store the output:
-        _mm_storeu_si128((__m128i*)*out, str);
+std::size_t base64_ssse3::encode_inplace(uint8_t* buffer, std::size_t size)
+{
+    return base64_encode_backward(&encode_backward_ssse3<alphabet::standard>,
+                                  tables::encode, buffer, size);
+}
 
-        *src += 16;
-        *out += 12;
-        remaining -= 16; // 16 bytes consumed per round
-        written += 12;   // 12 bytes produced per round
-        rounds -= 1;
-    }
+std::size_t base64_ssse3::encode_inplace_url(uint8_t* buffer,
+                                             std::size_t size)
+{
+    return base64_encode_backward(&encode_backward_ssse3<alphabet::url>,
+                                  tables::encode_url, buffer, size);
 }
 
-std::size_t base64_ssse3::encode(const uint8_t* src, std::size_t size,
-                                 uint8_t* out)
+std::size_t base64_ssse3::encode_inplace_custom(uint8_t* buffer,
+                                                std::size_t size,
+                                                const uint8_t* table)
 {
-    return base64_encode(&encode_loop_ssse3, src, size, out);
+    return base64_encode_backward(
+        [table](uint8_t* buffer, std::size_t& remaining)
+        { encode_backward_ssse3_custom(buffer, remaining, table); },
+        table, buffer, size);
 }
 
-std::size_t base64_ssse3::decode(const uint8_t* src, std::size_t size,
-                                 uint8_t* out, std::error_code& error)
+std::size_t base64_ssse3::encode_stream(const uint8_t* src, std::size_t size,
+                                        uint8_t* out)
+{
+    return base64_encode<alphabet::standard>(
+        &encode_stream_ssse3<alphabet::standard>, src, size, out);
+}
+
+std::size_t base64_ssse3::decode_stream(const uint8_t* src, std::size_t size,
+                                        uint8_t* out, std::error_code& error)
+{
+    return base64_decode<alphabet::standard>(
+        &decode_stream_ssse3<alphabet::standard>, src, size, out, error);
+}
+
+std::size_t base64_ssse3::encode_stream_url(const uint8_t* src,
+                                            std::size_t size, uint8_t* out)
+{
+    return base64_encode<alphabet::url>(&encode_stream_ssse3<alphabet::url>,
+                                        src, size, out);
+}
+
+std::size_t base64_ssse3::decode_stream_url(const uint8_t* src,
+                                            std::size_t size, uint8_t* out,
+                                            std::error_code& error)
+{
+    return base64_decode<alphabet::url>(&decode_stream_ssse3<alphabet::url>,
+                                        src, size, out, error);
+}
+
+std::size_t base64_ssse3::strip_whitespace(const uint8_t* src, std::size_t size,
+                                           uint8_t* out)
 {
-    return base64_decode(&decode_loop_ssse3, src, size, out, error);
+    return detail::strip_whitespace(&strip_loop_ssse3, src, size, out);
 }
 
 bool base64_ssse3::is_compiled()
@@ -273,6 +343,119 @@ std::size_t base64_ssse3::decode(const uint8_t*, std::size_t, uint8_t*,
     return 0;
 }
 
+std::size_t base64_ssse3::encode_url(const uint8_t*, std::size_t, uint8_t*)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_ssse3::decode_url(const uint8_t*, std::size_t, uint8_t*,
+                                     std::error_code&)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_ssse3::encode_custom(const uint8_t*, std::size_t, uint8_t*,
+                                        const uint8_t*)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_ssse3::decode_custom(const uint8_t*, std::size_t, uint8_t*,
+                                        const uint8_t*, std::error_code&)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+bool base64_ssse3::validate(const uint8_t*, std::size_t)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return false;
+}
+
+bool base64_ssse3::validate_url(const uint8_t*, std::size_t)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return false;
+}
+
+bool base64_ssse3::validate_custom(const uint8_t*, std::size_t, const uint8_t*)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return false;
+}
+
+std::size_t base64_ssse3::encode_inplace(uint8_t*, std::size_t)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_ssse3::encode_inplace_url(uint8_t*, std::size_t)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_ssse3::encode_inplace_custom(uint8_t*, std::size_t,
+                                                const uint8_t*)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_ssse3::encode_stream(const uint8_t*, std::size_t, uint8_t*)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_ssse3::decode_stream(const uint8_t*, std::size_t, uint8_t*,
+                                        std::error_code&)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_ssse3::encode_stream_url(const uint8_t*, std::size_t,
+                                            uint8_t*)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_ssse3::decode_stream_url(const uint8_t*, std::size_t,
+                                            uint8_t*, std::error_code&)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
+std::size_t base64_ssse3::strip_whitespace(const uint8_t*, std::size_t,
+                                           uint8_t*)
+{
+    assert(0 && "Target platform or compiler does not support this "
+                "implementation");
+    return 0;
+}
+
 bool base64_ssse3::is_compiled()
 {
     return false;
@@ -0,0 +1,86 @@
+// Copyright (c) Steinwurf ApS 2016.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include "../version.hpp"
+
+#include <cstdint>
+
+namespace aybabtu
+{
+inline namespace STEINWURF_AYBABTU_VERSION
+{
+namespace detail
+{
+/// Check characters without decoding them, using a 256 entry table that
+/// maps every character to its 6-bit value, or to 254 or 255 if it is
+/// invalid.
+/// @return true if every character is valid
+static inline bool base64_validate(const uint8_t* table, const uint8_t* src,
+                                   std::size_t size)
+{
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        if (table[src[i]] & 0x80)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Check whole groups of 4 characters through the four shifted 32-bit
+/// tables of the decoder, see decode_blocks. An invalid character sets bit
+/// 24 of its entry.
+/// @return true if every character is valid
+static inline bool validate_blocks(const uint32_t* shifted,
+                                   const uint8_t** src, std::size_t& remaining)
+{
+    const uint8_t* in = *src;
+    const uint8_t* end = in + remaining / 4 * 4;
+
+    // Stopping at the first invalid group also keeps the compiler from
+    // turning the lookups into much slower emulated gathers:
+    while (in != end)
+    {
+        const uint32_t word = shifted[in[0]] | shifted[256 + in[1]] |
+                              shifted[512 + in[2]] | shifted[768 + in[3]];
+        if (word >> 24 != 0)
+        {
+            return false;
+        }
+        in += 4;
+    }
+
+    remaining -= in - *src;
+    *src = in;
+    return true;
+}
+
+/// Check a string without padding, see base64_decode. The func callback
+/// checks the bulk of the string with simd. What it leaves, e.g. a string
+/// shorter than a vector, or all of it on codecs without a simd scan, is
+/// checked bytewise.
+/// @return true if the string can be decoded
+template <class Func>
+static inline bool base64_validate(Func func, const uint8_t* table,
+                                   const uint8_t* src, std::size_t size)
+{
+    if (size % 4 == 1)
+    {
+        return false;
+    }
+
+    std::size_t remaining = size;
+    if (!func(&src, remaining))
+    {
+        return false;
+    }
+    return base64_validate(table, src, remaining);
+}
+}
+}
+}
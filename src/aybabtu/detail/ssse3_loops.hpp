@@ -0,0 +1,808 @@
+// Copyright (c) Steinwurf ApS 2016.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include "../alphabet.hpp"
+#include "../version.hpp"
+
+#include <platform/config.hpp>
+
+#include <cstdint>
+#include <cstring>
+
+// Include x86 intrinsics for GCC-compatible compilers on x86/x86_64
+#if defined(PLATFORM_GCC_COMPATIBLE_X86)
+#include <x86intrin.h>
+#elif defined(PLATFORM_MSVC_X86)
+#include <immintrin.h>
+#endif
+
+// The encode and decode functions that the codecs pass to base64_encode and
+// base64_decode are forced inline. They are used by both the plain and the
+// streaming codecs, and GCC would otherwise call them out of line, passing
+// the pointers through memory, which costs short inputs several nanoseconds.
+#if defined(_MSC_VER)
+#define AYBABTU_FORCE_INLINE __forceinline
+#else
+#define AYBABTU_FORCE_INLINE inline __attribute__((always_inline))
+#endif
+
+namespace aybabtu
+{
+inline namespace STEINWURF_AYBABTU_VERSION
+{
+namespace detail
+{
+#ifdef PLATFORM_SSSE3
+
+// The SSSE3 loops are shared by the SSSE3 codec and the wider codecs, which
+// use them for the remainders that are too short for their own loops.
+
+// This code borrows from code from Alfred Klomp's library
+// https://github.com/aklomp/base64 (published under BSD)
+// The code has been modified to fit the aybabtu library.
+static inline __m128i enc_reshuffle(__m128i in)
+{
+    // Input, bytes MSB to LSB:
+    // 0 0 0 0 l k j i h g f e d c b a
+
+    in = _mm_shuffle_epi8(
+        in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+    // in, bytes MSB to LSB:
+    // k l j k
+    // h i g h
+    // e f d e
+    // b c a b
+
+    const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00));
+    // bits, upper case are most significant bits, lower case are least
+    // significant bits 0000kkkk LL000000 JJJJJJ00 00000000 0000hhhh II000000
+    // GGGGGG00 00000000 0000eeee FF000000 DDDDDD00 00000000 0000bbbb CC000000
+    // AAAAAA00 00000000
+
+    const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    // 00000000 00kkkkLL 00000000 00JJJJJJ
+    // 00000000 00hhhhII 00000000 00GGGGGG
+    // 00000000 00eeeeFF 00000000 00DDDDDD
+    // 00000000 00bbbbCC 00000000 00AAAAAA
+
+    const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003F03F0));
+    // 00000000 00llllll 000000jj KKKK0000
+    // 00000000 00iiiiii 000000gg HHHH0000
+    // 00000000 00ffffff 000000dd EEEE0000
+    // 00000000 00cccccc 000000aa BBBB0000
+
+    const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    // 00llllll 00000000 00jjKKKK 00000000
+    // 00iiiiii 00000000 00ggHHHH 00000000
+    // 00ffffff 00000000 00ddEEEE 00000000
+    // 00cccccc 00000000 00aaBBBB 00000000
+
+    return _mm_or_si128(t1, t3);
+    // 00llllll 00kkkkLL 00jjKKKK 00JJJJJJ
+    // 00iiiiii 00hhhhII 00ggHHHH 00GGGGGG
+    // 00ffffff 00eeeeFF 00ddEEEE 00DDDDDD
+    // 00cccccc 00bbbbCC 00aaBBBB 00AAAAAA
+}
+template <alphabet Alphabet>
+static inline __m128i enc_translate(const __m128i in)
+{
+    // A lookup table containing the absolute offsets for all ranges:
+    const __m128i lut =
+        Alphabet == alphabet::url
+            ? _mm_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4,
+                            -17, 32, 0, 0)
+            : _mm_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4,
+                            -19, -16, 0, 0);
+
+    // Translate values 0..63 to the Base64 alphabet. There are five sets:
+    // #  From      To         Abs    Index  Characters
+    // 0  [0..25]   [65..90]   +65        0  ABCDEFGHIJKLMNOPQRSTUVWXYZ
+    // 1  [26..51]  [97..122]  +71        1  abcdefghijklmnopqrstuvwxyz
+    // 2  [52..61]  [48..57]    -4  [2..11]  0123456789
+    // 3  [62]      [43]       -19       12  +
+    // 4  [63]      [47]       -16       13  /
+    //
+    // The url alphabet maps range #3 to '-' (-17) and range #4 to '_' (+32).
+
+    // Create LUT indices from the input. The index for range #0 is right,
+    // others are 1 less than expected:
+    __m128i indices = _mm_subs_epu8(in, _mm_set1_epi8(51));
+
+    // mask is 0xFF (-1) for range #[1..4] and 0x00 for range #0:
+    __m128i mask = _mm_cmpgt_epi8(in, _mm_set1_epi8(25));
+
+    // Subtract -1, so add 1 to indices for range #[1..4]. All indices are
+    // now correct:
+    indices = _mm_sub_epi8(indices, mask);
+
+    // Add offsets to input values:
+    return _mm_add_epi8(in, _mm_shuffle_epi8(lut, indices));
+}
+template <alphabet Alphabet>
+static inline void encode_loop_ssse3(const uint8_t** src,
+                                     std::size_t& remaining, uint8_t** out,
+                                     std::size_t& written)
+{
+    if (remaining < 16)
+    {
+        return;
+    }
+
+    // Process blocks of 12 bytes at a time. Because blocks are loaded 16
+    // bytes at a time, ensure that there will be at least 4 remaining
+    // bytes after the last round, so that the final read will not pass
+    // beyond the bounds of the input buffer:
+    size_t rounds = (remaining - 4) / 12;
+
+    // Encode four, and then two, blocks per round while enough remain, so
+    // that their independent chains overlap. The pointers are kept in locals,
+    // as the stores could otherwise alias them:
+    const uint8_t* in = *src;
+    uint8_t* it = *out;
+
+    while (rounds >= 4)
+    {
+        const __m128i a = _mm_loadu_si128((__m128i*)in);
+        const __m128i b = _mm_loadu_si128((__m128i*)(in + 12));
+        const __m128i c = _mm_loadu_si128((__m128i*)(in + 24));
+        const __m128i d = _mm_loadu_si128((__m128i*)(in + 36));
+
+        _mm_storeu_si128((__m128i*)it,
+                         enc_translate<Alphabet>(enc_reshuffle(a)));
+        _mm_storeu_si128((__m128i*)(it + 16),
+                         enc_translate<Alphabet>(enc_reshuffle(b)));
+        _mm_storeu_si128((__m128i*)(it + 32),
+                         enc_translate<Alphabet>(enc_reshuffle(c)));
+        _mm_storeu_si128((__m128i*)(it + 48),
+                         enc_translate<Alphabet>(enc_reshuffle(d)));
+
+        in += 48;
+        it += 64;
+        rounds -= 4;
+    }
+
+    while (rounds >= 2)
+    {
+        const __m128i a = _mm_loadu_si128((__m128i*)in);
+        const __m128i b = _mm_loadu_si128((__m128i*)(in + 12));
+
+        _mm_storeu_si128((__m128i*)it,
+                         enc_translate<Alphabet>(enc_reshuffle(a)));
+        _mm_storeu_si128((__m128i*)(it + 16),
+                         enc_translate<Alphabet>(enc_reshuffle(b)));
+
+        in += 24;
+        it += 32;
+        rounds -= 2;
+    }
+
+    remaining -= in - *src;
+    written += it - *out;
+    *src = in;
+    *out = it;
+
+    while (rounds > 0)
+    {
+        // Load input:
+        __m128i str = _mm_loadu_si128((__m128i*)*src);
+
+        // Reshuffle:
+        str = enc_reshuffle(str);
+
+        // Translate reshuffled bytes to the Base64 alphabet:
+        str = enc_translate<Alphabet>(str);
+
+        // Store:
+        _mm_storeu_si128((__m128i*)*out, str);
+
+        *src += 12;
+        *out += 16;
+        remaining -= 12; // 12 bytes consumed per round
+        written += 16;   // 16 bytes produced per round
+
+        rounds--;
+    }
+}
+
+static inline __m128i dec_reshuffle(const __m128i in)
+{
+    // in, bits, upper case are most significant bits, lower case
+    // are least significant bits
+    // 00llllll 00kkkkLL 00jjKKKK 00JJJJJJ
+    // 00iiiiii 00hhhhII 00ggHHHH 00GGGGGG
+    // 00ffffff 00eeeeFF 00ddEEEE 00DDDDDD
+    // 00cccccc 00bbbbCC 00aaBBBB 00AAAAAA
+
+    const __m128i merge_ab_and_bc =
+        _mm_maddubs_epi16(in, _mm_set1_epi32(0x01400140));
+    // 0000kkkk LLllllll 0000JJJJ JJjjKKKK
+    // 0000hhhh IIiiiiii 0000GGGG GGggHHHH
+    // 0000eeee FFffffff 0000DDDD DDddEEEE
+    // 0000bbbb CCcccccc 0000AAAA AAaaBBBB
+
+    const __m128i out =
+        _mm_madd_epi16(merge_ab_and_bc, _mm_set1_epi32(0x00011000));
+    // 00000000 JJJJJJjj KKKKkkkk LLllllll
+    // 00000000 GGGGGGgg HHHHhhhh IIiiiiii
+    // 00000000 DDDDDDdd EEEEeeee FFffffff
+    // 00000000 AAAAAAaa BBBBbbbb CCcccccc
+
+    // Pack bytes together:
+    return _mm_shuffle_epi8(out, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14,
+                                               13, 12, -1, -1, -1, -1));
+    // 00000000 00000000 00000000 00000000
+    // LLllllll KKKKkkkk JJJJJJjj IIiiiiii
+    // HHHHhhhh GGGGGGgg FFffffff EEEEeeee
+    // DDDDDDdd CCcccccc BBBBbbbb AAAAAAaa
+}
+
+// The lookup tables of the decoder's character classification. The url
+// alphabet has '-' in place of '+' and '_' in place of '/'. The '_'
+// characters are the only ones with a high nibble of 5 and a low nibble above
+// 10 that are valid, so they get a class bit of their own (0x20) in the
+// lookups. The delta of '_' is stored at index 0 of lut_roll.
+template <alphabet Alphabet>
+static inline __m128i dec_lut_lo()
+{
+    return Alphabet == alphabet::url
+               ? _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                               0x11, 0x11, 0x13, 0x3B, 0x3B, 0x3A, 0x3B, 0x33)
+               : _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                               0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+}
+
+template <alphabet Alphabet>
+static inline __m128i dec_lut_hi()
+{
+    return Alphabet == alphabet::url
+               ? _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x20,
+                               0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10)
+               : _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                               0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+}
+
+// Look up the classes of the characters in str. A byte of the result is not
+// zero if the character is invalid: if its "and" values from the lo and hi
+// lookups are not zero. The results of several blocks can be "or"ed together
+// and checked at once.
+template <alphabet Alphabet>
+static inline __m128i dec_classify(const __m128i str)
+{
+    const __m128i mask_2F = _mm_set1_epi8(0x2F);
+    const __m128i hi_nibbles = _mm_and_si128(_mm_srli_epi32(str, 4), mask_2F);
+    const __m128i lo_nibbles = _mm_and_si128(str, mask_2F);
+    const __m128i hi = _mm_shuffle_epi8(dec_lut_hi<Alphabet>(), hi_nibbles);
+    const __m128i lo = _mm_shuffle_epi8(dec_lut_lo<Alphabet>(), lo_nibbles);
+    return _mm_and_si128(lo, hi);
+}
+
+// Returns true if any byte of the classes from dec_classify is not zero.
+static inline bool dec_any_invalid(const __m128i classes)
+{
+    return _mm_movemask_epi8(
+               _mm_cmpgt_epi8(classes, _mm_setzero_si128())) != 0;
+}
+
+// Returns true if str holds an invalid character.
+template <alphabet Alphabet>
+static inline bool dec_invalid(const __m128i str)
+{
+    return dec_any_invalid(dec_classify<Alphabet>(str));
+}
+
+// Translate the valid characters in str to their 6-bit values.
+template <alphabet Alphabet>
+static inline __m128i dec_roll(const __m128i str)
+{
+    const __m128i lut_roll =
+        Alphabet == alphabet::url
+            ? _mm_setr_epi8(-32, 0, 17, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0,
+                            0, 0, 0)
+            : _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0,
+                            0, 0, 0);
+
+    const __m128i mask_2F = _mm_set1_epi8(0x2F);
+    const __m128i mask_5F = _mm_set1_epi8(0x5F);
+    const __m128i hi_nibbles = _mm_and_si128(_mm_srli_epi32(str, 4), mask_2F);
+
+    // Subtract 1 from the index of the '/' characters, or move the '_'
+    // characters to index 0:
+    const __m128i roll = _mm_shuffle_epi8(
+        lut_roll,
+        Alphabet == alphabet::url
+            ? _mm_subs_epu8(hi_nibbles, _mm_cmpeq_epi8(str, mask_5F))
+            : _mm_add_epi8(_mm_cmpeq_epi8(str, mask_2F), hi_nibbles));
+
+    // Now simply add the delta values to the input:
+    return _mm_add_epi8(str, roll);
+}
+
+// Translate the characters in str to their 6-bit values. Returns false, and
+// leaves str unchanged, if str holds an invalid character.
+template <alphabet Alphabet>
+static inline bool dec_translate(__m128i& str)
+{
+    if (dec_invalid<Alphabet>(str))
+    {
+        return false;
+    }
+    str = dec_roll<Alphabet>(str);
+    return true;
+}
+
+template <alphabet Alphabet>
+static inline void decode_loop_ssse3(const uint8_t** src,
+                                     std::size_t& remaining, uint8_t** out,
+                                     std::size_t& written)
+{
+    if (remaining < 24)
+    {
+        return;
+    }
+
+    // Process blocks of 16 bytes per round. Because 4 extra zero bytes are
+    // written after the output, ensure that there will be at least 8 bytes
+    // of input data left to cover the gap. (6 data bytes and up to two
+    // end-of-string markers.)
+    size_t rounds = (remaining - 8) / 16;
+
+    // Decode four, and then two, blocks per round while enough remain. The
+    // blocks are independent, so their chains overlap, and their classes
+    // are checked for invalid input at once. The single blocks below locate
+    // an invalid one. The stores are in order, so that the 4 zero bytes
+    // after each block are overwritten by the next. The pointers are kept in
+    // locals, as the stores could otherwise alias them:
+    const uint8_t* in = *src;
+    uint8_t* it = *out;
+
+    while (rounds >= 4)
+    {
+        const __m128i a = _mm_loadu_si128((__m128i*)in);
+        const __m128i b = _mm_loadu_si128((__m128i*)(in + 16));
+        const __m128i c = _mm_loadu_si128((__m128i*)(in + 32));
+        const __m128i d = _mm_loadu_si128((__m128i*)(in + 48));
+
+        if (dec_any_invalid(
+                _mm_or_si128(_mm_or_si128(dec_classify<Alphabet>(a),
+                                          dec_classify<Alphabet>(b)),
+                             _mm_or_si128(dec_classify<Alphabet>(c),
+                                          dec_classify<Alphabet>(d)))))
+        {
+            break;
+        }
+
+        _mm_storeu_si128((__m128i*)it, dec_reshuffle(dec_roll<Alphabet>(a)));
+        _mm_storeu_si128((__m128i*)(it + 12),
+                         dec_reshuffle(dec_roll<Alphabet>(b)));
+        _mm_storeu_si128((__m128i*)(it + 24),
+                         dec_reshuffle(dec_roll<Alphabet>(c)));
+        _mm_storeu_si128((__m128i*)(it + 36),
+                         dec_reshuffle(dec_roll<Alphabet>(d)));
+
+        in += 64;
+        it += 48;
+        rounds -= 4;
+    }
+
+    while (rounds >= 2)
+    {
+        const __m128i a = _mm_loadu_si128((__m128i*)in);
+        const __m128i b = _mm_loadu_si128((__m128i*)(in + 16));
+
+        if (dec_any_invalid(_mm_or_si128(dec_classify<Alphabet>(a),
+                                         dec_classify<Alphabet>(b))))
+        {
+            break;
+        }
+
+        _mm_storeu_si128((__m128i*)it, dec_reshuffle(dec_roll<Alphabet>(a)));
+        _mm_storeu_si128((__m128i*)(it + 12),
+                         dec_reshuffle(dec_roll<Alphabet>(b)));
+
+        in += 32;
+        it += 24;
+        rounds -= 2;
+    }
+
+    remaining -= in - *src;
+    written += it - *out;
+    *src = in;
+    *out = it;
+
+    while (rounds > 0)
+    {
+        // Load input:
+        __m128i str = _mm_loadu_si128((__m128i*)*src);
+
+        // Translate, on invalid input fall back on bytewise code to do error
+        // checking and reporting:
+        if (!dec_translate<Alphabet>(str))
+        {
+            break;
+        }
+
+        // Reshuffle the input to packed 12-byte output format:
+        str = dec_reshuffle(str);
+
+        // Store the output:
+        _mm_storeu_si128((__m128i*)*out, str);
+
+        *src += 16;
+        *out += 12;
+        remaining -= 16; // 16 bytes consumed per round
+        written += 12;   // 12 bytes produced per round
+        rounds -= 1;
+    }
+}
+
+// A custom alphabet has no ranges of consecutive characters to exploit, so
+// the translation is a plain table lookup. The 64 entry encode table is split
+// into four 16-byte rows, and the first 128 entries of the decode table into
+// eight. Every row is looked up with pshufb, and only applies to the values
+// at or above its first index. The rows are therefore loaded as the "xor" of
+// consecutive rows and accumulated under a compare mask, e.g. for a value in
+// row 2: row0 ^ (row0 ^ row1) ^ (row1 ^ row2) = row2.
+template <std::size_t Rows>
+static inline void load_rows(const uint8_t* table, __m128i* rows)
+{
+    rows[0] = _mm_loadu_si128((const __m128i*)table);
+    for (std::size_t i = 1; i < Rows; ++i)
+    {
+        rows[i] = _mm_xor_si128(_mm_loadu_si128((const __m128i*)table + i),
+                                _mm_loadu_si128((const __m128i*)table + i - 1));
+    }
+}
+
+template <std::size_t Rows>
+static inline __m128i lookup_rows(const __m128i* rows, const __m128i in)
+{
+    // Bytes with the most significant bit set, are below every row in a
+    // signed compare and are zeroed by pshufb:
+    __m128i result = _mm_shuffle_epi8(rows[0], in);
+    for (std::size_t i = 1; i < Rows; ++i)
+    {
+        const __m128i mask = _mm_cmpgt_epi8(in, _mm_set1_epi8(i * 16 - 1));
+        result = _mm_xor_si128(
+            result, _mm_and_si128(mask, _mm_shuffle_epi8(rows[i], in)));
+    }
+    return result;
+}
+
+static inline void encode_loop_ssse3_custom(const uint8_t** src,
+                                            std::size_t& remaining,
+                                            uint8_t** out,
+                                            std::size_t& written,
+                                            const uint8_t* table)
+{
+    if (remaining < 16)
+    {
+        return;
+    }
+
+    // See encode_loop_ssse3 for the bounds:
+    size_t rounds = (remaining - 4) / 12;
+
+    __m128i rows[4];
+    load_rows<4>(table, rows);
+
+    while (rounds > 0)
+    {
+        __m128i str = _mm_loadu_si128((__m128i*)*src);
+        str = enc_reshuffle(str);
+        str = lookup_rows<4>(rows, str);
+        _mm_storeu_si128((__m128i*)*out, str);
+
+        *src += 12;
+        *out += 16;
+        remaining -= 12; // 12 bytes consumed per round
+        written += 16;   // 16 bytes produced per round
+        rounds--;
+    }
+}
+
+static inline void decode_loop_ssse3_custom(const uint8_t** src,
+                                            std::size_t& remaining,
+                                            uint8_t** out,
+                                            std::size_t& written,
+                                            const uint8_t* table)
+{
+    if (remaining < 24)
+    {
+        return;
+    }
+
+    // See decode_loop_ssse3 for the bounds:
+    size_t rounds = (remaining - 8) / 16;
+
+    __m128i rows[8];
+    load_rows<8>(table, rows);
+
+    while (rounds > 0)
+    {
+        const __m128i str = _mm_loadu_si128((__m128i*)*src);
+        const __m128i values = lookup_rows<8>(rows, str);
+
+        // Invalid characters have the most significant bit set in values,
+        // non-ASCII characters in str. Fall back on bytewise code to do error
+        // checking and reporting:
+        if (_mm_movemask_epi8(_mm_or_si128(values, str)) != 0)
+        {
+            break;
+        }
+
+        _mm_storeu_si128((__m128i*)*out, dec_reshuffle(values));
+
+        *src += 16;
+        *out += 12;
+        remaining -= 16; // 16 bytes consumed per round
+        written += 12;   // 12 bytes produced per round
+        rounds -= 1;
+    }
+}
+
+// The whole groups left over by the loops are encoded with overlapping loads.
+// Every step loads the 16 bytes that end with the next (up to four) groups,
+// shifts out the first 4 bytes and stores the 16 characters that end with
+// the output of those groups. The bytes before the groups have been encoded
+// already, so they are rewritten with the same characters. An input shorter
+// than 16 bytes is left to the bytewise code, as there is nothing to load
+// from before the groups.
+template <class Translate>
+static inline void encode_tail_ssse3(Translate translate, const uint8_t** src,
+                                     std::size_t& remaining, uint8_t** out,
+                                     std::size_t& written)
+{
+    std::size_t groups = remaining / 3;
+
+    while (groups > 0)
+    {
+        const std::size_t step = groups < 4 ? groups : 4;
+
+        // Every 4 characters written so far are 3 bytes before *src:
+        if (written / 4 * 3 + step * 3 < 16)
+        {
+            return;
+        }
+
+        __m128i str = _mm_loadu_si128((__m128i*)(*src + step * 3 - 16));
+        str = translate(enc_reshuffle(_mm_srli_si128(str, 4)));
+        _mm_storeu_si128((__m128i*)(*out + step * 4 - 16), str);
+
+        *src += step * 3;
+        *out += step * 4;
+        remaining -= step * 3;
+        written += step * 4;
+        groups -= step;
+    }
+}
+
+// The whole groups left over by the loops are decoded with overlapping loads,
+// see encode_tail_ssse3. Every step stores exactly 12 bytes, so that nothing
+// is written beyond the output of the groups.
+template <class Translate>
+static inline void decode_tail_ssse3(Translate translate, const uint8_t** src,
+                                     std::size_t& remaining, uint8_t** out,
+                                     std::size_t& written)
+{
+    std::size_t groups = remaining / 4;
+
+    while (groups > 0)
+    {
+        const std::size_t step = groups < 4 ? groups : 4;
+
+        // Every 3 bytes written so far are 4 characters before *src:
+        if (written / 3 * 4 + step * 4 < 16)
+        {
+            return;
+        }
+
+        __m128i str = _mm_loadu_si128((__m128i*)(*src + step * 4 - 16));
+
+        // Leave invalid input to the bytewise code:
+        if (!translate(str))
+        {
+            return;
+        }
+
+        str = dec_reshuffle(str);
+        uint8_t* end = *out + step * 3;
+        _mm_storel_epi64((__m128i*)(end - 12), str);
+        const uint32_t last = _mm_cvtsi128_si32(_mm_srli_si128(str, 8));
+        std::memcpy(end - 4, &last, sizeof(last));
+
+        *src += step * 4;
+        *out += step * 3;
+        remaining -= step * 4;
+        written += step * 3;
+        groups -= step;
+    }
+}
+
+template <alphabet Alphabet>
+static AYBABTU_FORCE_INLINE void encode_ssse3(const uint8_t** src,
+                                              std::size_t& remaining,
+                                              uint8_t** out,
+                                              std::size_t& written)
+{
+    encode_loop_ssse3<Alphabet>(src, remaining, out, written);
+    encode_tail_ssse3([](const __m128i in)
+                      { return enc_translate<Alphabet>(in); },
+                      src, remaining, out, written);
+}
+
+// Encode the whole groups at the start of a buffer from the back, so that the
+// characters overwrite the bytes they encode, see base64_encode_backward.
+// Every round loads the 16 bytes that start with the last 12 bytes not yet
+// encoded. The last 4 bytes of the load are characters or data that
+// enc_reshuffle ignores, and the characters of a block start at or after
+// the block itself, so nothing is overwritten before it has been loaded.
+template <class Translate>
+static inline void encode_backward_loop_ssse3(Translate translate,
+                                              uint8_t* buffer,
+                                              std::size_t& remaining)
+{
+    while (remaining >= 12)
+    {
+        remaining -= 12;
+
+        __m128i str = _mm_loadu_si128((__m128i*)(buffer + remaining));
+        str = translate(enc_reshuffle(str));
+        _mm_storeu_si128((__m128i*)(buffer + remaining / 3 * 4), str);
+    }
+}
+
+template <alphabet Alphabet>
+static inline void encode_backward_ssse3(uint8_t* buffer,
+                                         std::size_t& remaining)
+{
+    encode_backward_loop_ssse3([](const __m128i in)
+                               { return enc_translate<Alphabet>(in); },
+                               buffer, remaining);
+}
+
+static inline void encode_backward_ssse3_custom(uint8_t* buffer,
+                                                std::size_t& remaining,
+                                                const uint8_t* table)
+{
+    if (remaining < 12)
+    {
+        return;
+    }
+
+    __m128i rows[4];
+    load_rows<4>(table, rows);
+
+    encode_backward_loop_ssse3([&rows](const __m128i in)
+                               { return lookup_rows<4>(rows, in); },
+                               buffer, remaining);
+}
+
+template <alphabet Alphabet>
+static AYBABTU_FORCE_INLINE void decode_ssse3(const uint8_t** src,
+                                              std::size_t& remaining,
+                                              uint8_t** out,
+                                              std::size_t& written)
+{
+    decode_loop_ssse3<Alphabet>(src, remaining, out, written);
+    decode_tail_ssse3([](__m128i& str) { return dec_translate<Alphabet>(str); },
+                      src, remaining, out, written);
+}
+
+static inline void encode_ssse3_custom(const uint8_t** src,
+                                       std::size_t& remaining, uint8_t** out,
+                                       std::size_t& written,
+                                       const uint8_t* table)
+{
+    encode_loop_ssse3_custom(src, remaining, out, written, table);
+    if (remaining < 3)
+    {
+        return;
+    }
+
+    __m128i rows[4];
+    load_rows<4>(table, rows);
+
+    encode_tail_ssse3([&rows](const __m128i in)
+                      { return lookup_rows<4>(rows, in); },
+                      src, remaining, out, written);
+}
+
+static inline void decode_ssse3_custom(const uint8_t** src,
+                                       std::size_t& remaining, uint8_t** out,
+                                       std::size_t& written,
+                                       const uint8_t* table)
+{
+    decode_loop_ssse3_custom(src, remaining, out, written, table);
+    if (remaining < 4)
+    {
+        return;
+    }
+
+    __m128i rows[8];
+    load_rows<8>(table, rows);
+
+    decode_tail_ssse3(
+        [&rows](__m128i& str)
+        {
+            const __m128i values = lookup_rows<8>(rows, str);
+            if (_mm_movemask_epi8(_mm_or_si128(values, str)) != 0)
+            {
+                return false;
+            }
+            str = values;
+            return true;
+        },
+        src, remaining, out, written);
+}
+
+// Check the characters 16 at a time with the classification of the decoder,
+// without translating them. The last block is loaded so that it ends with
+// the string, overlapping the block before it. Strings shorter than 16
+// bytes are left to the bytewise code.
+template <class Invalid>
+static inline bool validate_loop_ssse3(Invalid invalid, const uint8_t** src,
+                                       std::size_t& remaining)
+{
+    if (remaining < 16)
+    {
+        return true;
+    }
+
+    const uint8_t* it = *src;
+    const uint8_t* end = *src + remaining;
+
+    for (; end - it >= 16; it += 16)
+    {
+        if (invalid(_mm_loadu_si128((__m128i*)it)))
+        {
+            return false;
+        }
+    }
+
+    if (it != end && invalid(_mm_loadu_si128((__m128i*)(end - 16))))
+    {
+        return false;
+    }
+
+    *src = end;
+    remaining = 0;
+    return true;
+}
+
+template <alphabet Alphabet>
+static inline bool validate_ssse3(const uint8_t** src, std::size_t& remaining)
+{
+    return validate_loop_ssse3([](const __m128i str)
+                               { return dec_invalid<Alphabet>(str); },
+                               src, remaining);
+}
+
+// Custom alphabets are classified as in decode_loop_ssse3_custom.
+static inline bool validate_ssse3_custom(const uint8_t** src,
+                                         std::size_t& remaining,
+                                         const uint8_t* table)
+{
+    if (remaining < 16)
+    {
+        return true;
+    }
+
+    __m128i rows[8];
+    load_rows<8>(table, rows);
+
+    return validate_loop_ssse3(
+        [&rows](const __m128i str)
+        {
+            const __m128i values = lookup_rows<8>(rows, str);
+            return _mm_movemask_epi8(_mm_or_si128(values, str)) != 0;
+        },
+        src, remaining);
+}
+#endif
+}
+}
+}
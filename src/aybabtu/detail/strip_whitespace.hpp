@@ -0,0 +1,51 @@
+// Copyright (c) Steinwurf ApS 2016.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include "../version.hpp"
+
+#include <cstdint>
+
+namespace aybabtu
+{
+inline namespace STEINWURF_AYBABTU_VERSION
+{
+namespace detail
+{
+/// @return true if c is ASCII whitespace, i.e. ' ', '\t', '\n', '\v', '\f'
+///         or '\r'
+static inline bool is_whitespace(uint8_t c)
+{
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+/// Copy src to out without the ASCII whitespace. The func callback copies
+/// the bulk of the data, the rest is copied bytewise.
+/// @return the number of bytes written to out, at most size
+template <class Func>
+static inline std::size_t strip_whitespace(Func func, const uint8_t* src,
+                                           std::size_t size, uint8_t* out)
+{
+    std::size_t written = 0;
+    std::size_t remaining = size;
+
+    func(&src, remaining, &out, written);
+
+    while (remaining > 0)
+    {
+        if (!is_whitespace(*src))
+        {
+            *out++ = *src;
+            written++;
+        }
+        src++;
+        remaining--;
+    }
+    return written;
+}
+}
+}
+}
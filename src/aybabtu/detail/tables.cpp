@@ -18,6 +18,271 @@ namespace detail
 const uint8_t tables::encode[] =
     "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
 
+const uint8_t tables::encode_url[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+// The pairs of characters for every 12-bit value, the first character is
+// given by the upper 6 bits:
+const uint8_t tables::encode_pairs[] =
+    "AAABACADAEAFAGAHAIAJAKALAMANAOAPAQARASATAUAVAWAXAYAZAaAbAcAdAeAf"
+    "AgAhAiAjAkAlAmAnAoApAqArAsAtAuAvAwAxAyAzA0A1A2A3A4A5A6A7A8A9A+A/"
+    "BABBBCBDBEBFBGBHBIBJBKBLBMBNBOBPBQBRBSBTBUBVBWBXBYBZBaBbBcBdBeBf"
+    "BgBhBiBjBkBlBmBnBoBpBqBrBsBtBuBvBwBxByBzB0B1B2B3B4B5B6B7B8B9B+B/"
+    "CACBCCCDCECFCGCHCICJCKCLCMCNCOCPCQCRCSCTCUCVCWCXCYCZCaCbCcCdCeCf"
+    "CgChCiCjCkClCmCnCoCpCqCrCsCtCuCvCwCxCyCzC0C1C2C3C4C5C6C7C8C9C+C/"
+    "DADBDCDDDEDFDGDHDIDJDKDLDMDNDODPDQDRDSDTDUDVDWDXDYDZDaDbDcDdDeDf"
+    "DgDhDiDjDkDlDmDnDoDpDqDrDsDtDuDvDwDxDyDzD0D1D2D3D4D5D6D7D8D9D+D/"
+    "EAEBECEDEEEFEGEHEIEJEKELEMENEOEPEQERESETEUEVEWEXEYEZEaEbEcEdEeEf"
+    "EgEhEiEjEkElEmEnEoEpEqErEsEtEuEvEwExEyEzE0E1E2E3E4E5E6E7E8E9E+E/"
+    "FAFBFCFDFEFFFGFHFIFJFKFLFMFNFOFPFQFRFSFTFUFVFWFXFYFZFaFbFcFdFeFf"
+    "FgFhFiFjFkFlFmFnFoFpFqFrFsFtFuFvFwFxFyFzF0F1F2F3F4F5F6F7F8F9F+F/"
+    "GAGBGCGDGEGFGGGHGIGJGKGLGMGNGOGPGQGRGSGTGUGVGWGXGYGZGaGbGcGdGeGf"
+    "GgGhGiGjGkGlGmGnGoGpGqGrGsGtGuGvGwGxGyGzG0G1G2G3G4G5G6G7G8G9G+G/"
+    "HAHBHCHDHEHFHGHHHIHJHKHLHMHNHOHPHQHRHSHTHUHVHWHXHYHZHaHbHcHdHeHf"
+    "HgHhHiHjHkHlHmHnHoHpHqHrHsHtHuHvHwHxHyHzH0H1H2H3H4H5H6H7H8H9H+H/"
+    "IAIBICIDIEIFIGIHIIIJIKILIMINIOIPIQIRISITIUIVIWIXIYIZIaIbIcIdIeIf"
+    "IgIhIiIjIkIlImInIoIpIqIrIsItIuIvIwIxIyIzI0I1I2I3I4I5I6I7I8I9I+I/"
+    "JAJBJCJDJEJFJGJHJIJJJKJLJMJNJOJPJQJRJSJTJUJVJWJXJYJZJaJbJcJdJeJf"
+    "JgJhJiJjJkJlJmJnJoJpJqJrJsJtJuJvJwJxJyJzJ0J1J2J3J4J5J6J7J8J9J+J/"
+    "KAKBKCKDKEKFKGKHKIKJKKKLKMKNKOKPKQKRKSKTKUKVKWKXKYKZKaKbKcKdKeKf"
+    "KgKhKiKjKkKlKmKnKoKpKqKrKsKtKuKvKwKxKyKzK0K1K2K3K4K5K6K7K8K9K+K/"
+    "LALBLCLDLELFLGLHLILJLKLLLMLNLOLPLQLRLSLTLULVLWLXLYLZLaLbLcLdLeLf"
+    "LgLhLiLjLkLlLmLnLoLpLqLrLsLtLuLvLwLxLyLzL0L1L2L3L4L5L6L7L8L9L+L/"
+    "MAMBMCMDMEMFMGMHMIMJMKMLMMMNMOMPMQMRMSMTMUMVMWMXMYMZMaMbMcMdMeMf"
+    "MgMhMiMjMkMlMmMnMoMpMqMrMsMtMuMvMwMxMyMzM0M1M2M3M4M5M6M7M8M9M+M/"
+    "NANBNCNDNENFNGNHNINJNKNLNMNNNONPNQNRNSNTNUNVNWNXNYNZNaNbNcNdNeNf"
+    "NgNhNiNjNkNlNmNnNoNpNqNrNsNtNuNvNwNxNyNzN0N1N2N3N4N5N6N7N8N9N+N/"
+    "OAOBOCODOEOFOGOHOIOJOKOLOMONOOOPOQOROSOTOUOVOWOXOYOZOaObOcOdOeOf"
+    "OgOhOiOjOkOlOmOnOoOpOqOrOsOtOuOvOwOxOyOzO0O1O2O3O4O5O6O7O8O9O+O/"
+    "PAPBPCPDPEPFPGPHPIPJPKPLPMPNPOPPPQPRPSPTPUPVPWPXPYPZPaPbPcPdPePf"
+    "PgPhPiPjPkPlPmPnPoPpPqPrPsPtPuPvPwPxPyPzP0P1P2P3P4P5P6P7P8P9P+P/"
+    "QAQBQCQDQEQFQGQHQIQJQKQLQMQNQOQPQQQRQSQTQUQVQWQXQYQZQaQbQcQdQeQf"
+    "QgQhQiQjQkQlQmQnQoQpQqQrQsQtQuQvQwQxQyQzQ0Q1Q2Q3Q4Q5Q6Q7Q8Q9Q+Q/"
+    "RARBRCRDRERFRGRHRIRJRKRLRMRNRORPRQRRRSRTRURVRWRXRYRZRaRbRcRdReRf"
+    "RgRhRiRjRkRlRmRnRoRpRqRrRsRtRuRvRwRxRyRzR0R1R2R3R4R5R6R7R8R9R+R/"
+    "SASBSCSDSESFSGSHSISJSKSLSMSNSOSPSQSRSSSTSUSVSWSXSYSZSaSbScSdSeSf"
+    "SgShSiSjSkSlSmSnSoSpSqSrSsStSuSvSwSxSySzS0S1S2S3S4S5S6S7S8S9S+S/"
+    "TATBTCTDTETFTGTHTITJTKTLTMTNTOTPTQTRTSTTTUTVTWTXTYTZTaTbTcTdTeTf"
+    "TgThTiTjTkTlTmTnToTpTqTrTsTtTuTvTwTxTyTzT0T1T2T3T4T5T6T7T8T9T+T/"
+    "UAUBUCUDUEUFUGUHUIUJUKULUMUNUOUPUQURUSUTUUUVUWUXUYUZUaUbUcUdUeUf"
+    "UgUhUiUjUkUlUmUnUoUpUqUrUsUtUuUvUwUxUyUzU0U1U2U3U4U5U6U7U8U9U+U/"
+    "VAVBVCVDVEVFVGVHVIVJVKVLVMVNVOVPVQVRVSVTVUVVVWVXVYVZVaVbVcVdVeVf"
+    "VgVhViVjVkVlVmVnVoVpVqVrVsVtVuVvVwVxVyVzV0V1V2V3V4V5V6V7V8V9V+V/"
+    "WAWBWCWDWEWFWGWHWIWJWKWLWMWNWOWPWQWRWSWTWUWVWWWXWYWZWaWbWcWdWeWf"
+    "WgWhWiWjWkWlWmWnWoWpWqWrWsWtWuWvWwWxWyWzW0W1W2W3W4W5W6W7W8W9W+W/"
+    "XAXBXCXDXEXFXGXHXIXJXKXLXMXNXOXPXQXRXSXTXUXVXWXXXYXZXaXbXcXdXeXf"
+    "XgXhXiXjXkXlXmXnXoXpXqXrXsXtXuXvXwXxXyXzX0X1X2X3X4X5X6X7X8X9X+X/"
+    "YAYBYCYDYEYFYGYHYIYJYKYLYMYNYOYPYQYRYSYTYUYVYWYXYYYZYaYbYcYdYeYf"
+    "YgYhYiYjYkYlYmYnYoYpYqYrYsYtYuYvYwYxYyYzY0Y1Y2Y3Y4Y5Y6Y7Y8Y9Y+Y/"
+    "ZAZBZCZDZEZFZGZHZIZJZKZLZMZNZOZPZQZRZSZTZUZVZWZXZYZZZaZbZcZdZeZf"
+    "ZgZhZiZjZkZlZmZnZoZpZqZrZsZtZuZvZwZxZyZzZ0Z1Z2Z3Z4Z5Z6Z7Z8Z9Z+Z/"
+    "aAaBaCaDaEaFaGaHaIaJaKaLaMaNaOaPaQaRaSaTaUaVaWaXaYaZaaabacadaeaf"
+    "agahaiajakalamanaoapaqarasatauavawaxayaza0a1a2a3a4a5a6a7a8a9a+a/"
+    "bAbBbCbDbEbFbGbHbIbJbKbLbMbNbObPbQbRbSbTbUbVbWbXbYbZbabbbcbdbebf"
+    "bgbhbibjbkblbmbnbobpbqbrbsbtbubvbwbxbybzb0b1b2b3b4b5b6b7b8b9b+b/"
+    "cAcBcCcDcEcFcGcHcIcJcKcLcMcNcOcPcQcRcScTcUcVcWcXcYcZcacbcccdcecf"
+    "cgchcicjckclcmcncocpcqcrcsctcucvcwcxcyczc0c1c2c3c4c5c6c7c8c9c+c/"
+    "dAdBdCdDdEdFdGdHdIdJdKdLdMdNdOdPdQdRdSdTdUdVdWdXdYdZdadbdcdddedf"
+    "dgdhdidjdkdldmdndodpdqdrdsdtdudvdwdxdydzd0d1d2d3d4d5d6d7d8d9d+d/"
+    "eAeBeCeDeEeFeGeHeIeJeKeLeMeNeOePeQeReSeTeUeVeWeXeYeZeaebecedeeef"
+    "egeheiejekelemeneoepeqereseteuevewexeyeze0e1e2e3e4e5e6e7e8e9e+e/"
+    "fAfBfCfDfEfFfGfHfIfJfKfLfMfNfOfPfQfRfSfTfUfVfWfXfYfZfafbfcfdfeff"
+    "fgfhfifjfkflfmfnfofpfqfrfsftfufvfwfxfyfzf0f1f2f3f4f5f6f7f8f9f+f/"
+    "gAgBgCgDgEgFgGgHgIgJgKgLgMgNgOgPgQgRgSgTgUgVgWgXgYgZgagbgcgdgegf"
+    "ggghgigjgkglgmgngogpgqgrgsgtgugvgwgxgygzg0g1g2g3g4g5g6g7g8g9g+g/"
+    "hAhBhChDhEhFhGhHhIhJhKhLhMhNhOhPhQhRhShThUhVhWhXhYhZhahbhchdhehf"
+    "hghhhihjhkhlhmhnhohphqhrhshthuhvhwhxhyhzh0h1h2h3h4h5h6h7h8h9h+h/"
+    "iAiBiCiDiEiFiGiHiIiJiKiLiMiNiOiPiQiRiSiTiUiViWiXiYiZiaibicidieif"
+    "igihiiijikiliminioipiqirisitiuiviwixiyizi0i1i2i3i4i5i6i7i8i9i+i/"
+    "jAjBjCjDjEjFjGjHjIjJjKjLjMjNjOjPjQjRjSjTjUjVjWjXjYjZjajbjcjdjejf"
+    "jgjhjijjjkjljmjnjojpjqjrjsjtjujvjwjxjyjzj0j1j2j3j4j5j6j7j8j9j+j/"
+    "kAkBkCkDkEkFkGkHkIkJkKkLkMkNkOkPkQkRkSkTkUkVkWkXkYkZkakbkckdkekf"
+    "kgkhkikjkkklkmknkokpkqkrksktkukvkwkxkykzk0k1k2k3k4k5k6k7k8k9k+k/"
+    "lAlBlClDlElFlGlHlIlJlKlLlMlNlOlPlQlRlSlTlUlVlWlXlYlZlalblcldlelf"
+    "lglhliljlklllmlnlolplqlrlsltlulvlwlxlylzl0l1l2l3l4l5l6l7l8l9l+l/"
+    "mAmBmCmDmEmFmGmHmImJmKmLmMmNmOmPmQmRmSmTmUmVmWmXmYmZmambmcmdmemf"
+    "mgmhmimjmkmlmmmnmompmqmrmsmtmumvmwmxmymzm0m1m2m3m4m5m6m7m8m9m+m/"
+    "nAnBnCnDnEnFnGnHnInJnKnLnMnNnOnPnQnRnSnTnUnVnWnXnYnZnanbncndnenf"
+    "ngnhninjnknlnmnnnonpnqnrnsntnunvnwnxnynzn0n1n2n3n4n5n6n7n8n9n+n/"
+    "oAoBoCoDoEoFoGoHoIoJoKoLoMoNoOoPoQoRoSoToUoVoWoXoYoZoaobocodoeof"
+    "ogohoiojokolomonooopoqorosotouovowoxoyozo0o1o2o3o4o5o6o7o8o9o+o/"
+    "pApBpCpDpEpFpGpHpIpJpKpLpMpNpOpPpQpRpSpTpUpVpWpXpYpZpapbpcpdpepf"
+    "pgphpipjpkplpmpnpopppqprpsptpupvpwpxpypzp0p1p2p3p4p5p6p7p8p9p+p/"
+    "qAqBqCqDqEqFqGqHqIqJqKqLqMqNqOqPqQqRqSqTqUqVqWqXqYqZqaqbqcqdqeqf"
+    "qgqhqiqjqkqlqmqnqoqpqqqrqsqtquqvqwqxqyqzq0q1q2q3q4q5q6q7q8q9q+q/"
+    "rArBrCrDrErFrGrHrIrJrKrLrMrNrOrPrQrRrSrTrUrVrWrXrYrZrarbrcrdrerf"
+    "rgrhrirjrkrlrmrnrorprqrrrsrtrurvrwrxryrzr0r1r2r3r4r5r6r7r8r9r+r/"
+    "sAsBsCsDsEsFsGsHsIsJsKsLsMsNsOsPsQsRsSsTsUsVsWsXsYsZsasbscsdsesf"
+    "sgshsisjskslsmsnsospsqsrssstsusvswsxsyszs0s1s2s3s4s5s6s7s8s9s+s/"
+    "tAtBtCtDtEtFtGtHtItJtKtLtMtNtOtPtQtRtStTtUtVtWtXtYtZtatbtctdtetf"
+    "tgthtitjtktltmtntotptqtrtstttutvtwtxtytzt0t1t2t3t4t5t6t7t8t9t+t/"
+    "uAuBuCuDuEuFuGuHuIuJuKuLuMuNuOuPuQuRuSuTuUuVuWuXuYuZuaubucudueuf"
+    "uguhuiujukulumunuoupuqurusutuuuvuwuxuyuzu0u1u2u3u4u5u6u7u8u9u+u/"
+    "vAvBvCvDvEvFvGvHvIvJvKvLvMvNvOvPvQvRvSvTvUvVvWvXvYvZvavbvcvdvevf"
+    "vgvhvivjvkvlvmvnvovpvqvrvsvtvuvvvwvxvyvzv0v1v2v3v4v5v6v7v8v9v+v/"
+    "wAwBwCwDwEwFwGwHwIwJwKwLwMwNwOwPwQwRwSwTwUwVwWwXwYwZwawbwcwdwewf"
+    "wgwhwiwjwkwlwmwnwowpwqwrwswtwuwvwwwxwywzw0w1w2w3w4w5w6w7w8w9w+w/"
+    "xAxBxCxDxExFxGxHxIxJxKxLxMxNxOxPxQxRxSxTxUxVxWxXxYxZxaxbxcxdxexf"
+    "xgxhxixjxkxlxmxnxoxpxqxrxsxtxuxvxwxxxyxzx0x1x2x3x4x5x6x7x8x9x+x/"
+    "yAyByCyDyEyFyGyHyIyJyKyLyMyNyOyPyQyRySyTyUyVyWyXyYyZyaybycydyeyf"
+    "ygyhyiyjykylymynyoypyqyrysytyuyvywyxyyyzy0y1y2y3y4y5y6y7y8y9y+y/"
+    "zAzBzCzDzEzFzGzHzIzJzKzLzMzNzOzPzQzRzSzTzUzVzWzXzYzZzazbzczdzezf"
+    "zgzhzizjzkzlzmznzozpzqzrzsztzuzvzwzxzyzzz0z1z2z3z4z5z6z7z8z9z+z/"
+    "0A0B0C0D0E0F0G0H0I0J0K0L0M0N0O0P0Q0R0S0T0U0V0W0X0Y0Z0a0b0c0d0e0f"
+    "0g0h0i0j0k0l0m0n0o0p0q0r0s0t0u0v0w0x0y0z000102030405060708090+0/"
+    "1A1B1C1D1E1F1G1H1I1J1K1L1M1N1O1P1Q1R1S1T1U1V1W1X1Y1Z1a1b1c1d1e1f"
+    "1g1h1i1j1k1l1m1n1o1p1q1r1s1t1u1v1w1x1y1z101112131415161718191+1/"
+    "2A2B2C2D2E2F2G2H2I2J2K2L2M2N2O2P2Q2R2S2T2U2V2W2X2Y2Z2a2b2c2d2e2f"
+    "2g2h2i2j2k2l2m2n2o2p2q2r2s2t2u2v2w2x2y2z202122232425262728292+2/"
+    "3A3B3C3D3E3F3G3H3I3J3K3L3M3N3O3P3Q3R3S3T3U3V3W3X3Y3Z3a3b3c3d3e3f"
+    "3g3h3i3j3k3l3m3n3o3p3q3r3s3t3u3v3w3x3y3z303132333435363738393+3/"
+    "4A4B4C4D4E4F4G4H4I4J4K4L4M4N4O4P4Q4R4S4T4U4V4W4X4Y4Z4a4b4c4d4e4f"
+    "4g4h4i4j4k4l4m4n4o4p4q4r4s4t4u4v4w4x4y4z404142434445464748494+4/"
+    "5A5B5C5D5E5F5G5H5I5J5K5L5M5N5O5P5Q5R5S5T5U5V5W5X5Y5Z5a5b5c5d5e5f"
+    "5g5h5i5j5k5l5m5n5o5p5q5r5s5t5u5v5w5x5y5z505152535455565758595+5/"
+    "6A6B6C6D6E6F6G6H6I6J6K6L6M6N6O6P6Q6R6S6T6U6V6W6X6Y6Z6a6b6c6d6e6f"
+    "6g6h6i6j6k6l6m6n6o6p6q6r6s6t6u6v6w6x6y6z606162636465666768696+6/"
+    "7A7B7C7D7E7F7G7H7I7J7K7L7M7N7O7P7Q7R7S7T7U7V7W7X7Y7Z7a7b7c7d7e7f"
+    "7g7h7i7j7k7l7m7n7o7p7q7r7s7t7u7v7w7x7y7z707172737475767778797+7/"
+    "8A8B8C8D8E8F8G8H8I8J8K8L8M8N8O8P8Q8R8S8T8U8V8W8X8Y8Z8a8b8c8d8e8f"
+    "8g8h8i8j8k8l8m8n8o8p8q8r8s8t8u8v8w8x8y8z808182838485868788898+8/"
+    "9A9B9C9D9E9F9G9H9I9J9K9L9M9N9O9P9Q9R9S9T9U9V9W9X9Y9Z9a9b9c9d9e9f"
+    "9g9h9i9j9k9l9m9n9o9p9q9r9s9t9u9v9w9x9y9z909192939495969798999+9/"
+    "+A+B+C+D+E+F+G+H+I+J+K+L+M+N+O+P+Q+R+S+T+U+V+W+X+Y+Z+a+b+c+d+e+f"
+    "+g+h+i+j+k+l+m+n+o+p+q+r+s+t+u+v+w+x+y+z+0+1+2+3+4+5+6+7+8+9+++/"
+    "/A/B/C/D/E/F/G/H/I/J/K/L/M/N/O/P/Q/R/S/T/U/V/W/X/Y/Z/a/b/c/d/e/f"
+    "/g/h/i/j/k/l/m/n/o/p/q/r/s/t/u/v/w/x/y/z/0/1/2/3/4/5/6/7/8/9/+//";
+
+const uint8_t tables::encode_pairs_url[] =
+    "AAABACADAEAFAGAHAIAJAKALAMANAOAPAQARASATAUAVAWAXAYAZAaAbAcAdAeAf"
+    "AgAhAiAjAkAlAmAnAoApAqArAsAtAuAvAwAxAyAzA0A1A2A3A4A5A6A7A8A9A-A_"
+    "BABBBCBDBEBFBGBHBIBJBKBLBMBNBOBPBQBRBSBTBUBVBWBXBYBZBaBbBcBdBeBf"
+    "BgBhBiBjBkBlBmBnBoBpBqBrBsBtBuBvBwBxByBzB0B1B2B3B4B5B6B7B8B9B-B_"
+    "CACBCCCDCECFCGCHCICJCKCLCMCNCOCPCQCRCSCTCUCVCWCXCYCZCaCbCcCdCeCf"
+    "CgChCiCjCkClCmCnCoCpCqCrCsCtCuCvCwCxCyCzC0C1C2C3C4C5C6C7C8C9C-C_"
+    "DADBDCDDDEDFDGDHDIDJDKDLDMDNDODPDQDRDSDTDUDVDWDXDYDZDaDbDcDdDeDf"
+    "DgDhDiDjDkDlDmDnDoDpDqDrDsDtDuDvDwDxDyDzD0D1D2D3D4D5D6D7D8D9D-D_"
+    "EAEBECEDEEEFEGEHEIEJEKELEMENEOEPEQERESETEUEVEWEXEYEZEaEbEcEdEeEf"
+    "EgEhEiEjEkElEmEnEoEpEqErEsEtEuEvEwExEyEzE0E1E2E3E4E5E6E7E8E9E-E_"
+    "FAFBFCFDFEFFFGFHFIFJFKFLFMFNFOFPFQFRFSFTFUFVFWFXFYFZFaFbFcFdFeFf"
+    "FgFhFiFjFkFlFmFnFoFpFqFrFsFtFuFvFwFxFyFzF0F1F2F3F4F5F6F7F8F9F-F_"
+    "GAGBGCGDGEGFGGGHGIGJGKGLGMGNGOGPGQGRGSGTGUGVGWGXGYGZGaGbGcGdGeGf"
+    "GgGhGiGjGkGlGmGnGoGpGqGrGsGtGuGvGwGxGyGzG0G1G2G3G4G5G6G7G8G9G-G_"
+    "HAHBHCHDHEHFHGHHHIHJHKHLHMHNHOHPHQHRHSHTHUHVHWHXHYHZHaHbHcHdHeHf"
+    "HgHhHiHjHkHlHmHnHoHpHqHrHsHtHuHvHwHxHyHzH0H1H2H3H4H5H6H7H8H9H-H_"
+    "IAIBICIDIEIFIGIHIIIJIKILIMINIOIPIQIRISITIUIVIWIXIYIZIaIbIcIdIeIf"
+    "IgIhIiIjIkIlImInIoIpIqIrIsItIuIvIwIxIyIzI0I1I2I3I4I5I6I7I8I9I-I_"
+    "JAJBJCJDJEJFJGJHJIJJJKJLJMJNJOJPJQJRJSJTJUJVJWJXJYJZJaJbJcJdJeJf"
+    "JgJhJiJjJkJlJmJnJoJpJqJrJsJtJuJvJwJxJyJzJ0J1J2J3J4J5J6J7J8J9J-J_"
+    "KAKBKCKDKEKFKGKHKIKJKKKLKMKNKOKPKQKRKSKTKUKVKWKXKYKZKaKbKcKdKeKf"
+    "KgKhKiKjKkKlKmKnKoKpKqKrKsKtKuKvKwKxKyKzK0K1K2K3K4K5K6K7K8K9K-K_"
+    "LALBLCLDLELFLGLHLILJLKLLLMLNLOLPLQLRLSLTLULVLWLXLYLZLaLbLcLdLeLf"
+    "LgLhLiLjLkLlLmLnLoLpLqLrLsLtLuLvLwLxLyLzL0L1L2L3L4L5L6L7L8L9L-L_"
+    "MAMBMCMDMEMFMGMHMIMJMKMLMMMNMOMPMQMRMSMTMUMVMWMXMYMZMaMbMcMdMeMf"
+    "MgMhMiMjMkMlMmMnMoMpMqMrMsMtMuMvMwMxMyMzM0M1M2M3M4M5M6M7M8M9M-M_"
+    "NANBNCNDNENFNGNHNINJNKNLNMNNNONPNQNRNSNTNUNVNWNXNYNZNaNbNcNdNeNf"
+    "NgNhNiNjNkNlNmNnNoNpNqNrNsNtNuNvNwNxNyNzN0N1N2N3N4N5N6N7N8N9N-N_"
+    "OAOBOCODOEOFOGOHOIOJOKOLOMONOOOPOQOROSOTOUOVOWOXOYOZOaObOcOdOeOf"
+    "OgOhOiOjOkOlOmOnOoOpOqOrOsOtOuOvOwOxOyOzO0O1O2O3O4O5O6O7O8O9O-O_"
+    "PAPBPCPDPEPFPGPHPIPJPKPLPMPNPOPPPQPRPSPTPUPVPWPXPYPZPaPbPcPdPePf"
+    "PgPhPiPjPkPlPmPnPoPpPqPrPsPtPuPvPwPxPyPzP0P1P2P3P4P5P6P7P8P9P-P_"
+    "QAQBQCQDQEQFQGQHQIQJQKQLQMQNQOQPQQQRQSQTQUQVQWQXQYQZQaQbQcQdQeQf"
+    "QgQhQiQjQkQlQmQnQoQpQqQrQsQtQuQvQwQxQyQzQ0Q1Q2Q3Q4Q5Q6Q7Q8Q9Q-Q_"
+    "RARBRCRDRERFRGRHRIRJRKRLRMRNRORPRQRRRSRTRURVRWRXRYRZRaRbRcRdReRf"
+    "RgRhRiRjRkRlRmRnRoRpRqRrRsRtRuRvRwRxRyRzR0R1R2R3R4R5R6R7R8R9R-R_"
+    "SASBSCSDSESFSGSHSISJSKSLSMSNSOSPSQSRSSSTSUSVSWSXSYSZSaSbScSdSeSf"
+    "SgShSiSjSkSlSmSnSoSpSqSrSsStSuSvSwSxSySzS0S1S2S3S4S5S6S7S8S9S-S_"
+    "TATBTCTDTETFTGTHTITJTKTLTMTNTOTPTQTRTSTTTUTVTWTXTYTZTaTbTcTdTeTf"
+    "TgThTiTjTkTlTmTnToTpTqTrTsTtTuTvTwTxTyTzT0T1T2T3T4T5T6T7T8T9T-T_"
+    "UAUBUCUDUEUFUGUHUIUJUKULUMUNUOUPUQURUSUTUUUVUWUXUYUZUaUbUcUdUeUf"
+    "UgUhUiUjUkUlUmUnUoUpUqUrUsUtUuUvUwUxUyUzU0U1U2U3U4U5U6U7U8U9U-U_"
+    "VAVBVCVDVEVFVGVHVIVJVKVLVMVNVOVPVQVRVSVTVUVVVWVXVYVZVaVbVcVdVeVf"
+    "VgVhViVjVkVlVmVnVoVpVqVrVsVtVuVvVwVxVyVzV0V1V2V3V4V5V6V7V8V9V-V_"
+    "WAWBWCWDWEWFWGWHWIWJWKWLWMWNWOWPWQWRWSWTWUWVWWWXWYWZWaWbWcWdWeWf"
+    "WgWhWiWjWkWlWmWnWoWpWqWrWsWtWuWvWwWxWyWzW0W1W2W3W4W5W6W7W8W9W-W_"
+    "XAXBXCXDXEXFXGXHXIXJXKXLXMXNXOXPXQXRXSXTXUXVXWXXXYXZXaXbXcXdXeXf"
+    "XgXhXiXjXkXlXmXnXoXpXqXrXsXtXuXvXwXxXyXzX0X1X2X3X4X5X6X7X8X9X-X_"
+    "YAYBYCYDYEYFYGYHYIYJYKYLYMYNYOYPYQYRYSYTYUYVYWYXYYYZYaYbYcYdYeYf"
+    "YgYhYiYjYkYlYmYnYoYpYqYrYsYtYuYvYwYxYyYzY0Y1Y2Y3Y4Y5Y6Y7Y8Y9Y-Y_"
+    "ZAZBZCZDZEZFZGZHZIZJZKZLZMZNZOZPZQZRZSZTZUZVZWZXZYZZZaZbZcZdZeZf"
+    "ZgZhZiZjZkZlZmZnZoZpZqZrZsZtZuZvZwZxZyZzZ0Z1Z2Z3Z4Z5Z6Z7Z8Z9Z-Z_"
+    "aAaBaCaDaEaFaGaHaIaJaKaLaMaNaOaPaQaRaSaTaUaVaWaXaYaZaaabacadaeaf"
+    "agahaiajakalamanaoapaqarasatauavawaxayaza0a1a2a3a4a5a6a7a8a9a-a_"
+    "bAbBbCbDbEbFbGbHbIbJbKbLbMbNbObPbQbRbSbTbUbVbWbXbYbZbabbbcbdbebf"
+    "bgbhbibjbkblbmbnbobpbqbrbsbtbubvbwbxbybzb0b1b2b3b4b5b6b7b8b9b-b_"
+    "cAcBcCcDcEcFcGcHcIcJcKcLcMcNcOcPcQcRcScTcUcVcWcXcYcZcacbcccdcecf"
+    "cgchcicjckclcmcncocpcqcrcsctcucvcwcxcyczc0c1c2c3c4c5c6c7c8c9c-c_"
+    "dAdBdCdDdEdFdGdHdIdJdKdLdMdNdOdPdQdRdSdTdUdVdWdXdYdZdadbdcdddedf"
+    "dgdhdidjdkdldmdndodpdqdrdsdtdudvdwdxdydzd0d1d2d3d4d5d6d7d8d9d-d_"
+    "eAeBeCeDeEeFeGeHeIeJeKeLeMeNeOePeQeReSeTeUeVeWeXeYeZeaebecedeeef"
+    "egeheiejekelemeneoepeqereseteuevewexeyeze0e1e2e3e4e5e6e7e8e9e-e_"
+    "fAfBfCfDfEfFfGfHfIfJfKfLfMfNfOfPfQfRfSfTfUfVfWfXfYfZfafbfcfdfeff"
+    "fgfhfifjfkflfmfnfofpfqfrfsftfufvfwfxfyfzf0f1f2f3f4f5f6f7f8f9f-f_"
+    "gAgBgCgDgEgFgGgHgIgJgKgLgMgNgOgPgQgRgSgTgUgVgWgXgYgZgagbgcgdgegf"
+    "ggghgigjgkglgmgngogpgqgrgsgtgugvgwgxgygzg0g1g2g3g4g5g6g7g8g9g-g_"
+    "hAhBhChDhEhFhGhHhIhJhKhLhMhNhOhPhQhRhShThUhVhWhXhYhZhahbhchdhehf"
+    "hghhhihjhkhlhmhnhohphqhrhshthuhvhwhxhyhzh0h1h2h3h4h5h6h7h8h9h-h_"
+    "iAiBiCiDiEiFiGiHiIiJiKiLiMiNiOiPiQiRiSiTiUiViWiXiYiZiaibicidieif"
+    "igihiiijikiliminioipiqirisitiuiviwixiyizi0i1i2i3i4i5i6i7i8i9i-i_"
+    "jAjBjCjDjEjFjGjHjIjJjKjLjMjNjOjPjQjRjSjTjUjVjWjXjYjZjajbjcjdjejf"
+    "jgjhjijjjkjljmjnjojpjqjrjsjtjujvjwjxjyjzj0j1j2j3j4j5j6j7j8j9j-j_"
+    "kAkBkCkDkEkFkGkHkIkJkKkLkMkNkOkPkQkRkSkTkUkVkWkXkYkZkakbkckdkekf"
+    "kgkhkikjkkklkmknkokpkqkrksktkukvkwkxkykzk0k1k2k3k4k5k6k7k8k9k-k_"
+    "lAlBlClDlElFlGlHlIlJlKlLlMlNlOlPlQlRlSlTlUlVlWlXlYlZlalblcldlelf"
+    "lglhliljlklllmlnlolplqlrlsltlulvlwlxlylzl0l1l2l3l4l5l6l7l8l9l-l_"
+    "mAmBmCmDmEmFmGmHmImJmKmLmMmNmOmPmQmRmSmTmUmVmWmXmYmZmambmcmdmemf"
+    "mgmhmimjmkmlmmmnmompmqmrmsmtmumvmwmxmymzm0m1m2m3m4m5m6m7m8m9m-m_"
+    "nAnBnCnDnEnFnGnHnInJnKnLnMnNnOnPnQnRnSnTnUnVnWnXnYnZnanbncndnenf"
+    "ngnhninjnknlnmnnnonpnqnrnsntnunvnwnxnynzn0n1n2n3n4n5n6n7n8n9n-n_"
+    "oAoBoCoDoEoFoGoHoIoJoKoLoMoNoOoPoQoRoSoToUoVoWoXoYoZoaobocodoeof"
+    "ogohoiojokolomonooopoqorosotouovowoxoyozo0o1o2o3o4o5o6o7o8o9o-o_"
+    "pApBpCpDpEpFpGpHpIpJpKpLpMpNpOpPpQpRpSpTpUpVpWpXpYpZpapbpcpdpepf"
+    "pgphpipjpkplpmpnpopppqprpsptpupvpwpxpypzp0p1p2p3p4p5p6p7p8p9p-p_"
+    "qAqBqCqDqEqFqGqHqIqJqKqLqMqNqOqPqQqRqSqTqUqVqWqXqYqZqaqbqcqdqeqf"
+    "qgqhqiqjqkqlqmqnqoqpqqqrqsqtquqvqwqxqyqzq0q1q2q3q4q5q6q7q8q9q-q_"
+    "rArBrCrDrErFrGrHrIrJrKrLrMrNrOrPrQrRrSrTrUrVrWrXrYrZrarbrcrdrerf"
+    "rgrhrirjrkrlrmrnrorprqrrrsrtrurvrwrxryrzr0r1r2r3r4r5r6r7r8r9r-r_"
+    "sAsBsCsDsEsFsGsHsIsJsKsLsMsNsOsPsQsRsSsTsUsVsWsXsYsZsasbscsdsesf"
+    "sgshsisjskslsmsnsospsqsrssstsusvswsxsyszs0s1s2s3s4s5s6s7s8s9s-s_"
+    "tAtBtCtDtEtFtGtHtItJtKtLtMtNtOtPtQtRtStTtUtVtWtXtYtZtatbtctdtetf"
+    "tgthtitjtktltmtntotptqtrtstttutvtwtxtytzt0t1t2t3t4t5t6t7t8t9t-t_"
+    "uAuBuCuDuEuFuGuHuIuJuKuLuMuNuOuPuQuRuSuTuUuVuWuXuYuZuaubucudueuf"
+    "uguhuiujukulumunuoupuqurusutuuuvuwuxuyuzu0u1u2u3u4u5u6u7u8u9u-u_"
+    "vAvBvCvDvEvFvGvHvIvJvKvLvMvNvOvPvQvRvSvTvUvVvWvXvYvZvavbvcvdvevf"
+    "vgvhvivjvkvlvmvnvovpvqvrvsvtvuvvvwvxvyvzv0v1v2v3v4v5v6v7v8v9v-v_"
+    "wAwBwCwDwEwFwGwHwIwJwKwLwMwNwOwPwQwRwSwTwUwVwWwXwYwZwawbwcwdwewf"
+    "wgwhwiwjwkwlwmwnwowpwqwrwswtwuwvwwwxwywzw0w1w2w3w4w5w6w7w8w9w-w_"
+    "xAxBxCxDxExFxGxHxIxJxKxLxMxNxOxPxQxRxSxTxUxVxWxXxYxZxaxbxcxdxexf"
+    "xgxhxixjxkxlxmxnxoxpxqxrxsxtxuxvxwxxxyxzx0x1x2x3x4x5x6x7x8x9x-x_"
+    "yAyByCyDyEyFyGyHyIyJyKyLyMyNyOyPyQyRySyTyUyVyWyXyYyZyaybycydyeyf"
+    "ygyhyiyjykylymynyoypyqyrysytyuyvywyxyyyzy0y1y2y3y4y5y6y7y8y9y-y_"
+    "zAzBzCzDzEzFzGzHzIzJzKzLzMzNzOzPzQzRzSzTzUzVzWzXzYzZzazbzczdzezf"
+    "zgzhzizjzkzlzmznzozpzqzrzsztzuzvzwzxzyzzz0z1z2z3z4z5z6z7z8z9z-z_"
+    "0A0B0C0D0E0F0G0H0I0J0K0L0M0N0O0P0Q0R0S0T0U0V0W0X0Y0Z0a0b0c0d0e0f"
+    "0g0h0i0j0k0l0m0n0o0p0q0r0s0t0u0v0w0x0y0z000102030405060708090-0_"
+    "1A1B1C1D1E1F1G1H1I1J1K1L1M1N1O1P1Q1R1S1T1U1V1W1X1Y1Z1a1b1c1d1e1f"
+    "1g1h1i1j1k1l1m1n1o1p1q1r1s1t1u1v1w1x1y1z101112131415161718191-1_"
+    "2A2B2C2D2E2F2G2H2I2J2K2L2M2N2O2P2Q2R2S2T2U2V2W2X2Y2Z2a2b2c2d2e2f"
+    "2g2h2i2j2k2l2m2n2o2p2q2r2s2t2u2v2w2x2y2z202122232425262728292-2_"
+    "3A3B3C3D3E3F3G3H3I3J3K3L3M3N3O3P3Q3R3S3T3U3V3W3X3Y3Z3a3b3c3d3e3f"
+    "3g3h3i3j3k3l3m3n3o3p3q3r3s3t3u3v3w3x3y3z303132333435363738393-3_"
+    "4A4B4C4D4E4F4G4H4I4J4K4L4M4N4O4P4Q4R4S4T4U4V4W4X4Y4Z4a4b4c4d4e4f"
+    "4g4h4i4j4k4l4m4n4o4p4q4r4s4t4u4v4w4x4y4z404142434445464748494-4_"
+    "5A5B5C5D5E5F5G5H5I5J5K5L5M5N5O5P5Q5R5S5T5U5V5W5X5Y5Z5a5b5c5d5e5f"
+    "5g5h5i5j5k5l5m5n5o5p5q5r5s5t5u5v5w5x5y5z505152535455565758595-5_"
+    "6A6B6C6D6E6F6G6H6I6J6K6L6M6N6O6P6Q6R6S6T6U6V6W6X6Y6Z6a6b6c6d6e6f"
+    "6g6h6i6j6k6l6m6n6o6p6q6r6s6t6u6v6w6x6y6z606162636465666768696-6_"
+    "7A7B7C7D7E7F7G7H7I7J7K7L7M7N7O7P7Q7R7S7T7U7V7W7X7Y7Z7a7b7c7d7e7f"
+    "7g7h7i7j7k7l7m7n7o7p7q7r7s7t7u7v7w7x7y7z707172737475767778797-7_"
+    "8A8B8C8D8E8F8G8H8I8J8K8L8M8N8O8P8Q8R8S8T8U8V8W8X8Y8Z8a8b8c8d8e8f"
+    "8g8h8i8j8k8l8m8n8o8p8q8r8s8t8u8v8w8x8y8z808182838485868788898-8_"
+    "9A9B9C9D9E9F9G9H9I9J9K9L9M9N9O9P9Q9R9S9T9U9V9W9X9Y9Z9a9b9c9d9e9f"
+    "9g9h9i9j9k9l9m9n9o9p9q9r9s9t9u9v9w9x9y9z909192939495969798999-9_"
+    "-A-B-C-D-E-F-G-H-I-J-K-L-M-N-O-P-Q-R-S-T-U-V-W-X-Y-Z-a-b-c-d-e-f"
+    "-g-h-i-j-k-l-m-n-o-p-q-r-s-t-u-v-w-x-y-z-0-1-2-3-4-5-6-7-8-9---_"
+    "_A_B_C_D_E_F_G_H_I_J_K_L_M_N_O_P_Q_R_S_T_U_V_W_X_Y_Z_a_b_c_d_e_f"
+    "_g_h_i_j_k_l_m_n_o_p_q_r_s_t_u_v_w_x_y_z_0_1_2_3_4_5_6_7_8_9_-__";
+
 // clang-format off
 const uint8_t tables::decode[] =
 {
@@ -38,6 +303,558 @@ const uint8_t tables::decode[] =
 	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
 	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
 };
+
+const uint8_t tables::decode_url[] =
+{
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,		//   0..15
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,		//  16..31
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,  62, 255, 255,		//  32..47
+	 52,  53,  54,  55,  56,  57,  58,  59,  60,  61, 255, 255, 255, 254, 255, 255,		//  48..63
+	255,   0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,		//  64..79
+	 15,  16,  17,  18,  19,  20,  21,  22,  23,  24,  25, 255, 255, 255, 255,  63,		//  80..95
+	255,  26,  27,  28,  29,  30,  31,  32,  33,  34,  35,  36,  37,  38,  39,  40,		//  96..111
+	 41,  42,  43,  44,  45,  46,  47,  48,  49,  50,  51, 255, 255, 255, 255, 255,		// 112..127
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,		// 128..143
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+};
+
+const uint32_t tables::decode_shifted[] =
+{
+	// Character 1 of a group, shifted left by 18 bits:
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//   0..7
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//   8..15
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//  16..23
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//  24..31
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//  32..39
+	0x01000000, 0x01000000, 0x01000000, 0x00f80000, 0x01000000, 0x01000000, 0x01000000, 0x00fc0000,		//  40..47
+	0x00d00000, 0x00d40000, 0x00d80000, 0x00dc0000, 0x00e00000, 0x00e40000, 0x00e80000, 0x00ec0000,		//  48..55
+	0x00f00000, 0x00f40000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//  56..63
+	0x01000000, 0x00000000, 0x00040000, 0x00080000, 0x000c0000, 0x00100000, 0x00140000, 0x00180000,		//  64..71
+	0x001c0000, 0x00200000, 0x00240000, 0x00280000, 0x002c0000, 0x00300000, 0x00340000, 0x00380000,		//  72..79
+	0x003c0000, 0x00400000, 0x00440000, 0x00480000, 0x004c0000, 0x00500000, 0x00540000, 0x00580000,		//  80..87
+	0x005c0000, 0x00600000, 0x00640000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//  88..95
+	0x01000000, 0x00680000, 0x006c0000, 0x00700000, 0x00740000, 0x00780000, 0x007c0000, 0x00800000,		//  96..103
+	0x00840000, 0x00880000, 0x008c0000, 0x00900000, 0x00940000, 0x00980000, 0x009c0000, 0x00a00000,		// 104..111
+	0x00a40000, 0x00a80000, 0x00ac0000, 0x00b00000, 0x00b40000, 0x00b80000, 0x00bc0000, 0x00c00000,		// 112..119
+	0x00c40000, 0x00c80000, 0x00cc0000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 120..127
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 128..135
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 136..143
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 144..151
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 152..159
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 160..167
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 168..175
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 176..183
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 184..191
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 192..199
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 200..207
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 208..215
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 216..223
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 224..231
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 232..239
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 240..247
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 248..255
+	// Character 2 of a group, shifted left by 12 bits:
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//   0..7
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//   8..15
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//  16..23
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//  24..31
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//  32..39
+	0x01000000, 0x01000000, 0x01000000, 0x0003e000, 0x01000000, 0x01000000, 0x01000000, 0x0003f000,		//  40..47
+	0x00034000, 0x00035000, 0x00036000, 0x00037000, 0x00038000, 0x00039000, 0x0003a000, 0x0003b000,		//  48..55
+	0x0003c000, 0x0003d000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//  56..63
+	0x01000000, 0x00000000, 0x00001000, 0x00002000, 0x00003000, 0x00004000, 0x00005000, 0x00006000,		//  64..71
+	0x00007000, 0x00008000, 0x00009000, 0x0000a000, 0x0000b000, 0x0000c000, 0x0000d000, 0x0000e000,		//  72..79
+	0x0000f000, 0x00010000, 0x00011000, 0x00012000, 0x00013000, 0x00014000, 0x00015000, 0x00016000,		//  80..87
+	0x00017000, 0x00018000, 0x00019000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//  88..95
+	0x01000000, 0x0001a000, 0x0001b000, 0x0001c000, 0x0001d000, 0x0001e000, 0x0001f000, 0x00020000,		//  96..103
+	0x00021000, 0x00022000, 0x00023000, 0x00024000, 0x00025000, 0x00026000, 0x00027000, 0x00028000,		// 104..111
+	0x00029000, 0x0002a000, 0x0002b000, 0x0002c000, 0x0002d000, 0x0002e000, 0x0002f000, 0x00030000,		// 112..119
+	0x00031000, 0x00032000, 0x00033000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 120..127
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 128..135
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 136..143
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 144..151
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 152..159
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 160..167
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 168..175
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 176..183
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 184..191
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 192..199
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 200..207
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 208..215
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 216..223
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 224..231
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 232..239
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 240..247
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 248..255
+	// Character 3 of a group, shifted left by 6 bits:
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//   0..7
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//   8..15
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//  16..23
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//  24..31
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//  32..39
+	0x01000000, 0x01000000, 0x01000000, 0x00000f80, 0x01000000, 0x01000000, 0x01000000, 0x00000fc0,		//  40..47
+	0x00000d00, 0x00000d40, 0x00000d80, 0x00000dc0, 0x00000e00, 0x00000e40, 0x00000e80, 0x00000ec0,		//  48..55
+	0x00000f00, 0x00000f40, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//  56..63
+	0x01000000, 0x00000000, 0x00000040, 0x00000080, 0x000000c0, 0x00000100, 0x00000140, 0x00000180,		//  64..71
+	0x000001c0, 0x00000200, 0x00000240, 0x00000280, 0x000002c0, 0x00000300, 0x00000340, 0x00000380,		//  72..79
+	0x000003c0, 0x00000400, 0x00000440, 0x00000480, 0x000004c0, 0x00000500, 0x00000540, 0x00000580,		//  80..87
+	0x000005c0, 0x00000600, 0x00000640, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//  88..95
+	0x01000000, 0x00000680, 0x000006c0, 0x00000700, 0x00000740, 0x00000780, 0x000007c0, 0x00000800,		//  96..103
+	0x00000840, 0x00000880, 0x000008c0, 0x00000900, 0x00000940, 0x00000980, 0x000009c0, 0x00000a00,		// 104..111
+	0x00000a40, 0x00000a80, 0x00000ac0, 0x00000b00, 0x00000b40, 0x00000b80, 0x00000bc0, 0x00000c00,		// 112..119
+	0x00000c40, 0x00000c80, 0x00000cc0, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 120..127
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 128..135
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 136..143
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 144..151
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 152..159
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 160..167
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 168..175
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 176..183
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 184..191
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 192..199
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 200..207
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 208..215
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 216..223
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 224..231
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 232..239
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 240..247
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 248..255
+	// Character 4 of a group, shifted left by 0 bits:
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//   0..7
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//   8..15
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//  16..23
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//  24..31
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//  32..39
+	0x01000000, 0x01000000, 0x01000000, 0x0000003e, 0x01000000, 0x01000000, 0x01000000, 0x0000003f,		//  40..47
+	0x00000034, 0x00000035, 0x00000036, 0x00000037, 0x00000038, 0x00000039, 0x0000003a, 0x0000003b,		//  48..55
+	0x0000003c, 0x0000003d, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//  56..63
+	0x01000000, 0x00000000, 0x00000001, 0x00000002, 0x00000003, 0x00000004, 0x00000005, 0x00000006,		//  64..71
+	0x00000007, 0x00000008, 0x00000009, 0x0000000a, 0x0000000b, 0x0000000c, 0x0000000d, 0x0000000e,		//  72..79
+	0x0000000f, 0x00000010, 0x00000011, 0x00000012, 0x00000013, 0x00000014, 0x00000015, 0x00000016,		//  80..87
+	0x00000017, 0x00000018, 0x00000019, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//  88..95
+	0x01000000, 0x0000001a, 0x0000001b, 0x0000001c, 0x0000001d, 0x0000001e, 0x0000001f, 0x00000020,		//  96..103
+	0x00000021, 0x00000022, 0x00000023, 0x00000024, 0x00000025, 0x00000026, 0x00000027, 0x00000028,		// 104..111
+	0x00000029, 0x0000002a, 0x0000002b, 0x0000002c, 0x0000002d, 0x0000002e, 0x0000002f, 0x00000030,		// 112..119
+	0x00000031, 0x00000032, 0x00000033, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 120..127
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 128..135
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 136..143
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 144..151
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 152..159
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 160..167
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 168..175
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 176..183
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 184..191
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 192..199
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 200..207
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 208..215
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 216..223
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 224..231
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 232..239
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 240..247
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 248..255
+};
+
+const uint32_t tables::decode_shifted_url[] =
+{
+	// Character 1 of a group, shifted left by 18 bits:
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//   0..7
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//   8..15
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//  16..23
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//  24..31
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//  32..39
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x00f80000, 0x01000000, 0x01000000,		//  40..47
+	0x00d00000, 0x00d40000, 0x00d80000, 0x00dc0000, 0x00e00000, 0x00e40000, 0x00e80000, 0x00ec0000,		//  48..55
+	0x00f00000, 0x00f40000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//  56..63
+	0x01000000, 0x00000000, 0x00040000, 0x00080000, 0x000c0000, 0x00100000, 0x00140000, 0x00180000,		//  64..71
+	0x001c0000, 0x00200000, 0x00240000, 0x00280000, 0x002c0000, 0x00300000, 0x00340000, 0x00380000,		//  72..79
+	0x003c0000, 0x00400000, 0x00440000, 0x00480000, 0x004c0000, 0x00500000, 0x00540000, 0x00580000,		//  80..87
+	0x005c0000, 0x00600000, 0x00640000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x00fc0000,		//  88..95
+	0x01000000, 0x00680000, 0x006c0000, 0x00700000, 0x00740000, 0x00780000, 0x007c0000, 0x00800000,		//  96..103
+	0x00840000, 0x00880000, 0x008c0000, 0x00900000, 0x00940000, 0x00980000, 0x009c0000, 0x00a00000,		// 104..111
+	0x00a40000, 0x00a80000, 0x00ac0000, 0x00b00000, 0x00b40000, 0x00b80000, 0x00bc0000, 0x00c00000,		// 112..119
+	0x00c40000, 0x00c80000, 0x00cc0000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 120..127
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 128..135
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 136..143
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 144..151
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 152..159
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 160..167
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 168..175
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 176..183
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 184..191
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 192..199
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 200..207
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 208..215
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 216..223
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 224..231
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 232..239
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 240..247
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 248..255
+	// Character 2 of a group, shifted left by 12 bits:
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//   0..7
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//   8..15
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//  16..23
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//  24..31
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//  32..39
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x0003e000, 0x01000000, 0x01000000,		//  40..47
+	0x00034000, 0x00035000, 0x00036000, 0x00037000, 0x00038000, 0x00039000, 0x0003a000, 0x0003b000,		//  48..55
+	0x0003c000, 0x0003d000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//  56..63
+	0x01000000, 0x00000000, 0x00001000, 0x00002000, 0x00003000, 0x00004000, 0x00005000, 0x00006000,		//  64..71
+	0x00007000, 0x00008000, 0x00009000, 0x0000a000, 0x0000b000, 0x0000c000, 0x0000d000, 0x0000e000,		//  72..79
+	0x0000f000, 0x00010000, 0x00011000, 0x00012000, 0x00013000, 0x00014000, 0x00015000, 0x00016000,		//  80..87
+	0x00017000, 0x00018000, 0x00019000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x0003f000,		//  88..95
+	0x01000000, 0x0001a000, 0x0001b000, 0x0001c000, 0x0001d000, 0x0001e000, 0x0001f000, 0x00020000,		//  96..103
+	0x00021000, 0x00022000, 0x00023000, 0x00024000, 0x00025000, 0x00026000, 0x00027000, 0x00028000,		// 104..111
+	0x00029000, 0x0002a000, 0x0002b000, 0x0002c000, 0x0002d000, 0x0002e000, 0x0002f000, 0x00030000,		// 112..119
+	0x00031000, 0x00032000, 0x00033000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 120..127
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 128..135
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 136..143
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 144..151
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 152..159
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 160..167
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 168..175
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 176..183
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 184..191
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 192..199
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 200..207
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 208..215
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 216..223
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 224..231
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 232..239
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 240..247
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 248..255
+	// Character 3 of a group, shifted left by 6 bits:
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//   0..7
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//   8..15
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//  16..23
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//  24..31
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//  32..39
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x00000f80, 0x01000000, 0x01000000,		//  40..47
+	0x00000d00, 0x00000d40, 0x00000d80, 0x00000dc0, 0x00000e00, 0x00000e40, 0x00000e80, 0x00000ec0,		//  48..55
+	0x00000f00, 0x00000f40, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//  56..63
+	0x01000000, 0x00000000, 0x00000040, 0x00000080, 0x000000c0, 0x00000100, 0x00000140, 0x00000180,		//  64..71
+	0x000001c0, 0x00000200, 0x00000240, 0x00000280, 0x000002c0, 0x00000300, 0x00000340, 0x00000380,		//  72..79
+	0x000003c0, 0x00000400, 0x00000440, 0x00000480, 0x000004c0, 0x00000500, 0x00000540, 0x00000580,		//  80..87
+	0x000005c0, 0x00000600, 0x00000640, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x00000fc0,		//  88..95
+	0x01000000, 0x00000680, 0x000006c0, 0x00000700, 0x00000740, 0x00000780, 0x000007c0, 0x00000800,		//  96..103
+	0x00000840, 0x00000880, 0x000008c0, 0x00000900, 0x00000940, 0x00000980, 0x000009c0, 0x00000a00,		// 104..111
+	0x00000a40, 0x00000a80, 0x00000ac0, 0x00000b00, 0x00000b40, 0x00000b80, 0x00000bc0, 0x00000c00,		// 112..119
+	0x00000c40, 0x00000c80, 0x00000cc0, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 120..127
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 128..135
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 136..143
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 144..151
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 152..159
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 160..167
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 168..175
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 176..183
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 184..191
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 192..199
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 200..207
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 208..215
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 216..223
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 224..231
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 232..239
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 240..247
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 248..255
+	// Character 4 of a group, shifted left by 0 bits:
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//   0..7
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//   8..15
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//  16..23
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//  24..31
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//  32..39
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x0000003e, 0x01000000, 0x01000000,		//  40..47
+	0x00000034, 0x00000035, 0x00000036, 0x00000037, 0x00000038, 0x00000039, 0x0000003a, 0x0000003b,		//  48..55
+	0x0000003c, 0x0000003d, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		//  56..63
+	0x01000000, 0x00000000, 0x00000001, 0x00000002, 0x00000003, 0x00000004, 0x00000005, 0x00000006,		//  64..71
+	0x00000007, 0x00000008, 0x00000009, 0x0000000a, 0x0000000b, 0x0000000c, 0x0000000d, 0x0000000e,		//  72..79
+	0x0000000f, 0x00000010, 0x00000011, 0x00000012, 0x00000013, 0x00000014, 0x00000015, 0x00000016,		//  80..87
+	0x00000017, 0x00000018, 0x00000019, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x0000003f,		//  88..95
+	0x01000000, 0x0000001a, 0x0000001b, 0x0000001c, 0x0000001d, 0x0000001e, 0x0000001f, 0x00000020,		//  96..103
+	0x00000021, 0x00000022, 0x00000023, 0x00000024, 0x00000025, 0x00000026, 0x00000027, 0x00000028,		// 104..111
+	0x00000029, 0x0000002a, 0x0000002b, 0x0000002c, 0x0000002d, 0x0000002e, 0x0000002f, 0x00000030,		// 112..119
+	0x00000031, 0x00000032, 0x00000033, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 120..127
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 128..135
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 136..143
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 144..151
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 152..159
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 160..167
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 168..175
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 176..183
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 184..191
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 192..199
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 200..207
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 208..215
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 216..223
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 224..231
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 232..239
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 240..247
+	0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,		// 248..255
+};
+
+const uint8_t tables::compress[] =
+{
+	128, 128, 128, 128, 128, 128, 128, 128,		//   0
+	  0, 128, 128, 128, 128, 128, 128, 128,		//   1
+	  1, 128, 128, 128, 128, 128, 128, 128,		//   2
+	  0,   1, 128, 128, 128, 128, 128, 128,		//   3
+	  2, 128, 128, 128, 128, 128, 128, 128,		//   4
+	  0,   2, 128, 128, 128, 128, 128, 128,		//   5
+	  1,   2, 128, 128, 128, 128, 128, 128,		//   6
+	  0,   1,   2, 128, 128, 128, 128, 128,		//   7
+	  3, 128, 128, 128, 128, 128, 128, 128,		//   8
+	  0,   3, 128, 128, 128, 128, 128, 128,		//   9
+	  1,   3, 128, 128, 128, 128, 128, 128,		//  10
+	  0,   1,   3, 128, 128, 128, 128, 128,		//  11
+	  2,   3, 128, 128, 128, 128, 128, 128,		//  12
+	  0,   2,   3, 128, 128, 128, 128, 128,		//  13
+	  1,   2,   3, 128, 128, 128, 128, 128,		//  14
+	  0,   1,   2,   3, 128, 128, 128, 128,		//  15
+	  4, 128, 128, 128, 128, 128, 128, 128,		//  16
+	  0,   4, 128, 128, 128, 128, 128, 128,		//  17
+	  1,   4, 128, 128, 128, 128, 128, 128,		//  18
+	  0,   1,   4, 128, 128, 128, 128, 128,		//  19
+	  2,   4, 128, 128, 128, 128, 128, 128,		//  20
+	  0,   2,   4, 128, 128, 128, 128, 128,		//  21
+	  1,   2,   4, 128, 128, 128, 128, 128,		//  22
+	  0,   1,   2,   4, 128, 128, 128, 128,		//  23
+	  3,   4, 128, 128, 128, 128, 128, 128,		//  24
+	  0,   3,   4, 128, 128, 128, 128, 128,		//  25
+	  1,   3,   4, 128, 128, 128, 128, 128,		//  26
+	  0,   1,   3,   4, 128, 128, 128, 128,		//  27
+	  2,   3,   4, 128, 128, 128, 128, 128,		//  28
+	  0,   2,   3,   4, 128, 128, 128, 128,		//  29
+	  1,   2,   3,   4, 128, 128, 128, 128,		//  30
+	  0,   1,   2,   3,   4, 128, 128, 128,		//  31
+	  5, 128, 128, 128, 128, 128, 128, 128,		//  32
+	  0,   5, 128, 128, 128, 128, 128, 128,		//  33
+	  1,   5, 128, 128, 128, 128, 128, 128,		//  34
+	  0,   1,   5, 128, 128, 128, 128, 128,		//  35
+	  2,   5, 128, 128, 128, 128, 128, 128,		//  36
+	  0,   2,   5, 128, 128, 128, 128, 128,		//  37
+	  1,   2,   5, 128, 128, 128, 128, 128,		//  38
+	  0,   1,   2,   5, 128, 128, 128, 128,		//  39
+	  3,   5, 128, 128, 128, 128, 128, 128,		//  40
+	  0,   3,   5, 128, 128, 128, 128, 128,		//  41
+	  1,   3,   5, 128, 128, 128, 128, 128,		//  42
+	  0,   1,   3,   5, 128, 128, 128, 128,		//  43
+	  2,   3,   5, 128, 128, 128, 128, 128,		//  44
+	  0,   2,   3,   5, 128, 128, 128, 128,		//  45
+	  1,   2,   3,   5, 128, 128, 128, 128,		//  46
+	  0,   1,   2,   3,   5, 128, 128, 128,		//  47
+	  4,   5, 128, 128, 128, 128, 128, 128,		//  48
+	  0,   4,   5, 128, 128, 128, 128, 128,		//  49
+	  1,   4,   5, 128, 128, 128, 128, 128,		//  50
+	  0,   1,   4,   5, 128, 128, 128, 128,		//  51
+	  2,   4,   5, 128, 128, 128, 128, 128,		//  52
+	  0,   2,   4,   5, 128, 128, 128, 128,		//  53
+	  1,   2,   4,   5, 128, 128, 128, 128,		//  54
+	  0,   1,   2,   4,   5, 128, 128, 128,		//  55
+	  3,   4,   5, 128, 128, 128, 128, 128,		//  56
+	  0,   3,   4,   5, 128, 128, 128, 128,		//  57
+	  1,   3,   4,   5, 128, 128, 128, 128,		//  58
+	  0,   1,   3,   4,   5, 128, 128, 128,		//  59
+	  2,   3,   4,   5, 128, 128, 128, 128,		//  60
+	  0,   2,   3,   4,   5, 128, 128, 128,		//  61
+	  1,   2,   3,   4,   5, 128, 128, 128,		//  62
+	  0,   1,   2,   3,   4,   5, 128, 128,		//  63
+	  6, 128, 128, 128, 128, 128, 128, 128,		//  64
+	  0,   6, 128, 128, 128, 128, 128, 128,		//  65
+	  1,   6, 128, 128, 128, 128, 128, 128,		//  66
+	  0,   1,   6, 128, 128, 128, 128, 128,		//  67
+	  2,   6, 128, 128, 128, 128, 128, 128,		//  68
+	  0,   2,   6, 128, 128, 128, 128, 128,		//  69
+	  1,   2,   6, 128, 128, 128, 128, 128,		//  70
+	  0,   1,   2,   6, 128, 128, 128, 128,		//  71
+	  3,   6, 128, 128, 128, 128, 128, 128,		//  72
+	  0,   3,   6, 128, 128, 128, 128, 128,		//  73
+	  1,   3,   6, 128, 128, 128, 128, 128,		//  74
+	  0,   1,   3,   6, 128, 128, 128, 128,		//  75
+	  2,   3,   6, 128, 128, 128, 128, 128,		//  76
+	  0,   2,   3,   6, 128, 128, 128, 128,		//  77
+	  1,   2,   3,   6, 128, 128, 128, 128,		//  78
+	  0,   1,   2,   3,   6, 128, 128, 128,		//  79
+	  4,   6, 128, 128, 128, 128, 128, 128,		//  80
+	  0,   4,   6, 128, 128, 128, 128, 128,		//  81
+	  1,   4,   6, 128, 128, 128, 128, 128,		//  82
+	  0,   1,   4,   6, 128, 128, 128, 128,		//  83
+	  2,   4,   6, 128, 128, 128, 128, 128,		//  84
+	  0,   2,   4,   6, 128, 128, 128, 128,		//  85
+	  1,   2,   4,   6, 128, 128, 128, 128,		//  86
+	  0,   1,   2,   4,   6, 128, 128, 128,		//  87
+	  3,   4,   6, 128, 128, 128, 128, 128,		//  88
+	  0,   3,   4,   6, 128, 128, 128, 128,		//  89
+	  1,   3,   4,   6, 128, 128, 128, 128,		//  90
+	  0,   1,   3,   4,   6, 128, 128, 128,		//  91
+	  2,   3,   4,   6, 128, 128, 128, 128,		//  92
+	  0,   2,   3,   4,   6, 128, 128, 128,		//  93
+	  1,   2,   3,   4,   6, 128, 128, 128,		//  94
+	  0,   1,   2,   3,   4,   6, 128, 128,		//  95
+	  5,   6, 128, 128, 128, 128, 128, 128,		//  96
+	  0,   5,   6, 128, 128, 128, 128, 128,		//  97
+	  1,   5,   6, 128, 128, 128, 128, 128,		//  98
+	  0,   1,   5,   6, 128, 128, 128, 128,		//  99
+	  2,   5,   6, 128, 128, 128, 128, 128,		// 100
+	  0,   2,   5,   6, 128, 128, 128, 128,		// 101
+	  1,   2,   5,   6, 128, 128, 128, 128,		// 102
+	  0,   1,   2,   5,   6, 128, 128, 128,		// 103
+	  3,   5,   6, 128, 128, 128, 128, 128,		// 104
+	  0,   3,   5,   6, 128, 128, 128, 128,		// 105
+	  1,   3,   5,   6, 128, 128, 128, 128,		// 106
+	  0,   1,   3,   5,   6, 128, 128, 128,		// 107
+	  2,   3,   5,   6, 128, 128, 128, 128,		// 108
+	  0,   2,   3,   5,   6, 128, 128, 128,		// 109
+	  1,   2,   3,   5,   6, 128, 128, 128,		// 110
+	  0,   1,   2,   3,   5,   6, 128, 128,		// 111
+	  4,   5,   6, 128, 128, 128, 128, 128,		// 112
+	  0,   4,   5,   6, 128, 128, 128, 128,		// 113
+	  1,   4,   5,   6, 128, 128, 128, 128,		// 114
+	  0,   1,   4,   5,   6, 128, 128, 128,		// 115
+	  2,   4,   5,   6, 128, 128, 128, 128,		// 116
+	  0,   2,   4,   5,   6, 128, 128, 128,		// 117
+	  1,   2,   4,   5,   6, 128, 128, 128,		// 118
+	  0,   1,   2,   4,   5,   6, 128, 128,		// 119
+	  3,   4,   5,   6, 128, 128, 128, 128,		// 120
+	  0,   3,   4,   5,   6, 128, 128, 128,		// 121
+	  1,   3,   4,   5,   6, 128, 128, 128,		// 122
+	  0,   1,   3,   4,   5,   6, 128, 128,		// 123
+	  2,   3,   4,   5,   6, 128, 128, 128,		// 124
+	  0,   2,   3,   4,   5,   6, 128, 128,		// 125
+	  1,   2,   3,   4,   5,   6, 128, 128,		// 126
+	  0,   1,   2,   3,   4,   5,   6, 128,		// 127
+	  7, 128, 128, 128, 128, 128, 128, 128,		// 128
+	  0,   7, 128, 128, 128, 128, 128, 128,		// 129
+	  1,   7, 128, 128, 128, 128, 128, 128,		// 130
+	  0,   1,   7, 128, 128, 128, 128, 128,		// 131
+	  2,   7, 128, 128, 128, 128, 128, 128,		// 132
+	  0,   2,   7, 128, 128, 128, 128, 128,		// 133
+	  1,   2,   7, 128, 128, 128, 128, 128,		// 134
+	  0,   1,   2,   7, 128, 128, 128, 128,		// 135
+	  3,   7, 128, 128, 128, 128, 128, 128,		// 136
+	  0,   3,   7, 128, 128, 128, 128, 128,		// 137
+	  1,   3,   7, 128, 128, 128, 128, 128,		// 138
+	  0,   1,   3,   7, 128, 128, 128, 128,		// 139
+	  2,   3,   7, 128, 128, 128, 128, 128,		// 140
+	  0,   2,   3,   7, 128, 128, 128, 128,		// 141
+	  1,   2,   3,   7, 128, 128, 128, 128,		// 142
+	  0,   1,   2,   3,   7, 128, 128, 128,		// 143
+	  4,   7, 128, 128, 128, 128, 128, 128,		// 144
+	  0,   4,   7, 128, 128, 128, 128, 128,		// 145
+	  1,   4,   7, 128, 128, 128, 128, 128,		// 146
+	  0,   1,   4,   7, 128, 128, 128, 128,		// 147
+	  2,   4,   7, 128, 128, 128, 128, 128,		// 148
+	  0,   2,   4,   7, 128, 128, 128, 128,		// 149
+	  1,   2,   4,   7, 128, 128, 128, 128,		// 150
+	  0,   1,   2,   4,   7, 128, 128, 128,		// 151
+	  3,   4,   7, 128, 128, 128, 128, 128,		// 152
+	  0,   3,   4,   7, 128, 128, 128, 128,		// 153
+	  1,   3,   4,   7, 128, 128, 128, 128,		// 154
+	  0,   1,   3,   4,   7, 128, 128, 128,		// 155
+	  2,   3,   4,   7, 128, 128, 128, 128,		// 156
+	  0,   2,   3,   4,   7, 128, 128, 128,		// 157
+	  1,   2,   3,   4,   7, 128, 128, 128,		// 158
+	  0,   1,   2,   3,   4,   7, 128, 128,		// 159
+	  5,   7, 128, 128, 128, 128, 128, 128,		// 160
+	  0,   5,   7, 128, 128, 128, 128, 128,		// 161
+	  1,   5,   7, 128, 128, 128, 128, 128,		// 162
+	  0,   1,   5,   7, 128, 128, 128, 128,		// 163
+	  2,   5,   7, 128, 128, 128, 128, 128,		// 164
+	  0,   2,   5,   7, 128, 128, 128, 128,		// 165
+	  1,   2,   5,   7, 128, 128, 128, 128,		// 166
+	  0,   1,   2,   5,   7, 128, 128, 128,		// 167
+	  3,   5,   7, 128, 128, 128, 128, 128,		// 168
+	  0,   3,   5,   7, 128, 128, 128, 128,		// 169
+	  1,   3,   5,   7, 128, 128, 128, 128,		// 170
+	  0,   1,   3,   5,   7, 128, 128, 128,		// 171
+	  2,   3,   5,   7, 128, 128, 128, 128,		// 172
+	  0,   2,   3,   5,   7, 128, 128, 128,		// 173
+	  1,   2,   3,   5,   7, 128, 128, 128,		// 174
+	  0,   1,   2,   3,   5,   7, 128, 128,		// 175
+	  4,   5,   7, 128, 128, 128, 128, 128,		// 176
+	  0,   4,   5,   7, 128, 128, 128, 128,		// 177
+	  1,   4,   5,   7, 128, 128, 128, 128,		// 178
+	  0,   1,   4,   5,   7, 128, 128, 128,		// 179
+	  2,   4,   5,   7, 128, 128, 128, 128,		// 180
+	  0,   2,   4,   5,   7, 128, 128, 128,		// 181
+	  1,   2,   4,   5,   7, 128, 128, 128,		// 182
+	  0,   1,   2,   4,   5,   7, 128, 128,		// 183
+	  3,   4,   5,   7, 128, 128, 128, 128,		// 184
+	  0,   3,   4,   5,   7, 128, 128, 128,		// 185
+	  1,   3,   4,   5,   7, 128, 128, 128,		// 186
+	  0,   1,   3,   4,   5,   7, 128, 128,		// 187
+	  2,   3,   4,   5,   7, 128, 128, 128,		// 188
+	  0,   2,   3,   4,   5,   7, 128, 128,		// 189
+	  1,   2,   3,   4,   5,   7, 128, 128,		// 190
+	  0,   1,   2,   3,   4,   5,   7, 128,		// 191
+	  6,   7, 128, 128, 128, 128, 128, 128,		// 192
+	  0,   6,   7, 128, 128, 128, 128, 128,		// 193
+	  1,   6,   7, 128, 128, 128, 128, 128,		// 194
+	  0,   1,   6,   7, 128, 128, 128, 128,		// 195
+	  2,   6,   7, 128, 128, 128, 128, 128,		// 196
+	  0,   2,   6,   7, 128, 128, 128, 128,		// 197
+	  1,   2,   6,   7, 128, 128, 128, 128,		// 198
+	  0,   1,   2,   6,   7, 128, 128, 128,		// 199
+	  3,   6,   7, 128, 128, 128, 128, 128,		// 200
+	  0,   3,   6,   7, 128, 128, 128, 128,		// 201
+	  1,   3,   6,   7, 128, 128, 128, 128,		// 202
+	  0,   1,   3,   6,   7, 128, 128, 128,		// 203
+	  2,   3,   6,   7, 128, 128, 128, 128,		// 204
+	  0,   2,   3,   6,   7, 128, 128, 128,		// 205
+	  1,   2,   3,   6,   7, 128, 128, 128,		// 206
+	  0,   1,   2,   3,   6,   7, 128, 128,		// 207
+	  4,   6,   7, 128, 128, 128, 128, 128,		// 208
+	  0,   4,   6,   7, 128, 128, 128, 128,		// 209
+	  1,   4,   6,   7, 128, 128, 128, 128,		// 210
+	  0,   1,   4,   6,   7, 128, 128, 128,		// 211
+	  2,   4,   6,   7, 128, 128, 128, 128,		// 212
+	  0,   2,   4,   6,   7, 128, 128, 128,		// 213
+	  1,   2,   4,   6,   7, 128, 128, 128,		// 214
+	  0,   1,   2,   4,   6,   7, 128, 128,		// 215
+	  3,   4,   6,   7, 128, 128, 128, 128,		// 216
+	  0,   3,   4,   6,   7, 128, 128, 128,		// 217
+	  1,   3,   4,   6,   7, 128, 128, 128,		// 218
+	  0,   1,   3,   4,   6,   7, 128, 128,		// 219
+	  2,   3,   4,   6,   7, 128, 128, 128,		// 220
+	  0,   2,   3,   4,   6,   7, 128, 128,		// 221
+	  1,   2,   3,   4,   6,   7, 128, 128,		// 222
+	  0,   1,   2,   3,   4,   6,   7, 128,		// 223
+	  5,   6,   7, 128, 128, 128, 128, 128,		// 224
+	  0,   5,   6,   7, 128, 128, 128, 128,		// 225
+	  1,   5,   6,   7, 128, 128, 128, 128,		// 226
+	  0,   1,   5,   6,   7, 128, 128, 128,		// 227
+	  2,   5,   6,   7, 128, 128, 128, 128,		// 228
+	  0,   2,   5,   6,   7, 128, 128, 128,		// 229
+	  1,   2,   5,   6,   7, 128, 128, 128,		// 230
+	  0,   1,   2,   5,   6,   7, 128, 128,		// 231
+	  3,   5,   6,   7, 128, 128, 128, 128,		// 232
+	  0,   3,   5,   6,   7, 128, 128, 128,		// 233
+	  1,   3,   5,   6,   7, 128, 128, 128,		// 234
+	  0,   1,   3,   5,   6,   7, 128, 128,		// 235
+	  2,   3,   5,   6,   7, 128, 128, 128,		// 236
+	  0,   2,   3,   5,   6,   7, 128, 128,		// 237
+	  1,   2,   3,   5,   6,   7, 128, 128,		// 238
+	  0,   1,   2,   3,   5,   6,   7, 128,		// 239
+	  4,   5,   6,   7, 128, 128, 128, 128,		// 240
+	  0,   4,   5,   6,   7, 128, 128, 128,		// 241
+	  1,   4,   5,   6,   7, 128, 128, 128,		// 242
+	  0,   1,   4,   5,   6,   7, 128, 128,		// 243
+	  2,   4,   5,   6,   7, 128, 128, 128,		// 244
+	  0,   2,   4,   5,   6,   7, 128, 128,		// 245
+	  1,   2,   4,   5,   6,   7, 128, 128,		// 246
+	  0,   1,   2,   4,   5,   6,   7, 128,		// 247
+	  3,   4,   5,   6,   7, 128, 128, 128,		// 248
+	  0,   3,   4,   5,   6,   7, 128, 128,		// 249
+	  1,   3,   4,   5,   6,   7, 128, 128,		// 250
+	  0,   1,   3,   4,   5,   6,   7, 128,		// 251
+	  2,   3,   4,   5,   6,   7, 128, 128,		// 252
+	  0,   2,   3,   4,   5,   6,   7, 128,		// 253
+	  1,   2,   3,   4,   5,   6,   7, 128,		// 254
+	  0,   1,   2,   3,   4,   5,   6,   7,		// 255
+};
 // clang-format on
 }
 }
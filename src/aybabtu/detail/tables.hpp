@@ -15,10 +15,31 @@ inline namespace STEINWURF_AYBABTU_VERSION
 {
 namespace detail
 {
+/// The scalar lookup tables. The decode tables map every character to its
+/// 6-bit value, '=' to 254 and every other invalid character to 255.
 struct tables
 {
     static const uint8_t encode[];
     static const uint8_t decode[];
+    static const uint8_t encode_url[];
+    static const uint8_t decode_url[];
+
+    /// The pairs of characters for every 12-bit value, 4096 entries of two
+    /// characters each, used to encode 12 bits at a time.
+    static const uint8_t encode_pairs[];
+    static const uint8_t encode_pairs_url[];
+
+    /// The 6-bit value of every character at each of the four positions in
+    /// a group, shifted to its place in the 24 decoded bits, 256 entries per
+    /// position. Invalid characters, including '=', map to 0x01000000, so
+    /// the OR of a group is invalid if any bit above the lower 24 is set.
+    static const uint32_t decode_shifted[];
+    static const uint32_t decode_shifted_url[];
+
+    /// The pshufb indices that move the bytes selected by an 8-bit mask to
+    /// the front of an 8-byte block, 8 entries per mask. The unused entries
+    /// are 128, which makes pshufb write a zero.
+    static const uint8_t compress[];
 };
 }
 }
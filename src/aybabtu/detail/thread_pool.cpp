@@ -0,0 +1,100 @@
+// Copyright (c) Steinwurf ApS 2016.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include "thread_pool.hpp"
+
+#include "../version.hpp"
+
+#include <cassert>
+
+namespace aybabtu
+{
+inline namespace STEINWURF_AYBABTU_VERSION
+{
+namespace detail
+{
+thread_pool::thread_pool(std::size_t threads)
+{
+    assert(threads > 0);
+
+    for (std::size_t i = 1; i < threads; ++i)
+    {
+        m_workers.emplace_back(&thread_pool::work, this);
+    }
+}
+
+thread_pool::~thread_pool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_start.notify_all();
+
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+std::size_t thread_pool::threads() const
+{
+    return m_workers.size() + 1;
+}
+
+void thread_pool::run(std::size_t tasks, const task_function& task)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    assert(m_task == nullptr);
+
+    m_task = &task;
+    m_tasks = tasks;
+    m_next = 0;
+    m_finished = 0;
+    m_job++;
+    m_start.notify_all();
+
+    claim(lock);
+    m_done.wait(lock, [this] { return m_finished == m_tasks; });
+    m_task = nullptr;
+}
+
+void thread_pool::work()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    uint64_t job = m_job;
+
+    while (true)
+    {
+        m_start.wait(lock, [this, job] { return m_stop || m_job != job; });
+        if (m_stop)
+        {
+            return;
+        }
+        job = m_job;
+        claim(lock);
+    }
+}
+
+void thread_pool::claim(std::unique_lock<std::mutex>& lock)
+{
+    while (m_task != nullptr && m_next < m_tasks)
+    {
+        const std::size_t index = m_next++;
+        const task_function& task = *m_task;
+
+        lock.unlock();
+        task(index);
+        lock.lock();
+
+        if (++m_finished == m_tasks)
+        {
+            m_done.notify_one();
+        }
+    }
+}
+}
+}
+}
@@ -0,0 +1,96 @@
+// Copyright (c) Steinwurf ApS 2016.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include "../version.hpp"
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace aybabtu
+{
+inline namespace STEINWURF_AYBABTU_VERSION
+{
+namespace detail
+{
+/// A fixed set of worker threads that run the tasks of one job at a time.
+/// The calling thread takes part in the job, so a pool of n threads starts
+/// n - 1 workers.
+class thread_pool
+{
+public:
+    /// The task run for every index of a job
+    using task_function = std::function<void(std::size_t index)>;
+
+    /// Create a pool and start its workers.
+    /// @param threads the number of threads to run a job on, including the
+    ///        calling thread, must be at least 1
+    explicit thread_pool(std::size_t threads);
+
+    /// Stop and join the workers
+    ~thread_pool();
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    /// @return the number of threads a job runs on, including the calling
+    ///         thread
+    std::size_t threads() const;
+
+    /// Run task(i) for every i in [0, tasks) and wait for all of them to
+    /// finish. Only one job runs at a time, so concurrent calls must be
+    /// serialized by the caller.
+    /// @param tasks the number of tasks
+    /// @param task the task to run, which must not throw
+    void run(std::size_t tasks, const task_function& task);
+
+private:
+    /// The loop of every worker thread
+    void work();
+
+    /// Run the unclaimed tasks of the current job on this thread
+    /// @param lock a lock on m_mutex, which is released while a task runs
+    void claim(std::unique_lock<std::mutex>& lock);
+
+private:
+    /// The worker threads
+    std::vector<std::thread> m_workers;
+
+    /// Protects the members below
+    std::mutex m_mutex;
+
+    /// Signals the workers that a job was started or the pool is stopped
+    std::condition_variable m_start;
+
+    /// Signals the caller that the last task of a job has finished
+    std::condition_variable m_done;
+
+    /// The task of the current job
+    const task_function* m_task = nullptr;
+
+    /// The number of tasks of the current job
+    std::size_t m_tasks = 0;
+
+    /// The index of the next task to be claimed
+    std::size_t m_next = 0;
+
+    /// The number of finished tasks
+    std::size_t m_finished = 0;
+
+    /// Incremented for every job, so the workers can tell a new job apart
+    /// from a spurious wakeup
+    uint64_t m_job = 0;
+
+    /// Set when the pool is destroyed
+    bool m_stop = false;
+};
+}
+}
+}
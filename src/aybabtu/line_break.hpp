@@ -0,0 +1,23 @@
+// Copyright (c) Steinwurf ApS 2016.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include "version.hpp"
+
+namespace aybabtu
+{
+inline namespace STEINWURF_AYBABTU_VERSION
+{
+/// The line break inserted between the lines of a wrapped encoded string
+enum class line_break
+{
+    /// A single '\n', e.g. for PEM
+    lf,
+    /// The two characters "\r\n", e.g. for MIME
+    crlf
+};
+}
+}
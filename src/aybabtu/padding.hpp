@@ -0,0 +1,23 @@
+// Copyright (c) Steinwurf ApS 2016.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include "version.hpp"
+
+namespace aybabtu
+{
+inline namespace STEINWURF_AYBABTU_VERSION
+{
+/// The use of '=' padding at the end of the encoded string
+enum class padding
+{
+    /// The encoded string is padded to a multiple of 4 characters
+    enabled,
+    /// The encoded string is not padded, and must not contain padding
+    disabled
+};
+}
+}
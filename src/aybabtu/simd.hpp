@@ -23,7 +23,14 @@ enum class simd
     /// AVX2 Acceleration
     avx2,
     /// NEON Acceleration
-    neon
+    neon,
+    /// AVX-512 VBMI Acceleration
+    avx512_vbmi,
+    /// AVX-512BW Acceleration
+    avx512_bw,
+    /// AVX-512VL Acceleration limited to 256-bit registers, which avoids the
+    /// frequency drop caused by 512-bit instructions on some CPUs
+    avx512_vl
 };
 }
 }
@@ -0,0 +1,24 @@
+// Copyright (c) Steinwurf ApS 2016.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include "version.hpp"
+
+namespace aybabtu
+{
+inline namespace STEINWURF_AYBABTU_VERSION
+{
+/// The handling of whitespace in an encoded string
+enum class whitespace
+{
+    /// Whitespace is invalid
+    reject,
+    /// ASCII whitespace (' ', '\t', '\n', '\v', '\f' and '\r') is skipped
+    /// anywhere in the string, e.g. the line breaks of MIME or PEM data
+    ignore
+};
+}
+}
@@ -6,17 +6,51 @@
 #include <aybabtu/base64.hpp>
 
 #include <algorithm>
-#include <cpuid/cpuinfo.hpp>
+#include <cstring>
+#include <initializer_list>
+#include <stdexcept>
 #include <vector>
 
 #include <gtest/gtest.h>
 
+static void test_encode_decode_url(const uint8_t* data, std::size_t size,
+                                   aybabtu::padding padding,
+                                   aybabtu::simd simd)
+{
+    // The url alphabet only differs in the last two characters:
+    auto expected = aybabtu::base64::encode(data, size, aybabtu::simd::none);
+    std::replace(expected.begin(), expected.end(), '+', '-');
+    std::replace(expected.begin(), expected.end(), '/', '_');
+    if (padding == aybabtu::padding::disabled)
+    {
+        expected.erase(expected.find_last_not_of('=') + 1);
+    }
+
+    auto encoded = aybabtu::base64::encode(data, size, aybabtu::alphabet::url,
+                                           padding, simd);
+    EXPECT_EQ(encoded.size(), aybabtu::base64::encode_size(size, padding));
+    EXPECT_EQ(expected, encoded);
+
+    auto decoded_size = aybabtu::base64::decode_size(encoded, padding);
+    std::vector<uint8_t> decoded(decoded_size);
+    std::error_code error;
+    auto written =
+        aybabtu::base64::decode(encoded, decoded.data(), error,
+                                aybabtu::alphabet::url, padding, simd);
+    ASSERT_FALSE((bool)error);
+    EXPECT_EQ(written, decoded_size);
+    ASSERT_EQ(decoded_size, size);
+    EXPECT_EQ(0, memcmp(data, decoded.data(), size));
+}
+
 static void test_encode_decode(const uint8_t* data, std::size_t size,
                                aybabtu::simd simd)
 {
     SCOPED_TRACE(testing::Message() << "size: " << size);
     auto encoded = aybabtu::base64::encode(data, size, simd);
     EXPECT_EQ(encoded.size(), aybabtu::base64::encode_size(size));
+    EXPECT_EQ(encoded,
+              aybabtu::base64::encode(data, size, aybabtu::simd::none));
     auto decoded_size =
         aybabtu::base64::decode_size(encoded.data(), encoded.size());
     std::vector<uint8_t> decoded(decoded_size);
@@ -27,6 +61,9 @@ static void test_encode_decode(const uint8_t* data, std::size_t size,
     EXPECT_EQ(written, decoded_size);
     ASSERT_EQ(decoded_size, size);
     EXPECT_EQ(0, memcmp(data, decoded.data(), size));
+
+    test_encode_decode_url(data, size, aybabtu::padding::enabled, simd);
+    test_encode_decode_url(data, size, aybabtu::padding::disabled, simd);
 }
 
 static void encode_decode_simd(aybabtu::simd simd)
@@ -73,36 +110,43 @@ static void encode_decode_simd(aybabtu::simd simd)
     }
 }
 
-TEST(test_base64, encode_decode)
+// The accelerations that can be requested on this machine:
+static std::vector<aybabtu::simd> supported_simd()
 {
-    cpuid::cpuinfo cpu{};
-
+    std::vector<aybabtu::simd> simds;
+    for (auto simd :
+         {aybabtu::simd::auto_, aybabtu::simd::none,
+          aybabtu::simd::avx512_vbmi, aybabtu::simd::avx512_bw,
+          aybabtu::simd::avx512_vl, aybabtu::simd::avx2, aybabtu::simd::ssse3,
+          aybabtu::simd::neon})
     {
-        SCOPED_TRACE(testing::Message() << "simd: auto");
-        encode_decode_simd(aybabtu::simd::auto_);
+        if (aybabtu::base64::is_supported(simd))
+        {
+            simds.push_back(simd);
+        }
     }
-    {
+    return simds;
+}
 
-        SCOPED_TRACE(testing::Message() << "simd: none");
-        encode_decode_simd(aybabtu::simd::none);
-    }
-    if (cpu.has_avx2())
-    {
-        SCOPED_TRACE(testing::Message() << "simd: avx2");
-        encode_decode_simd(aybabtu::simd::avx2);
-    }
-    if (cpu.has_ssse3())
-    {
-        SCOPED_TRACE(testing::Message() << "simd: ssse3");
-        encode_decode_simd(aybabtu::simd::ssse3);
-    }
-    if (cpu.has_neon())
+TEST(test_base64, encode_decode)
+{
+    for (auto simd : supported_simd())
     {
-        SCOPED_TRACE(testing::Message() << "simd: neon");
-        encode_decode_simd(aybabtu::simd::neon);
+        SCOPED_TRACE(testing::Message() << "simd: " << (int)simd);
+        encode_decode_simd(simd);
     }
 }
 
+TEST(test_base64, is_supported)
+{
+    EXPECT_TRUE(aybabtu::base64::is_supported(aybabtu::simd::auto_));
+    EXPECT_TRUE(aybabtu::base64::is_supported(aybabtu::simd::none));
+
+    // The automatic selection only picks supported accelerations:
+    EXPECT_TRUE(
+        aybabtu::base64::is_supported(aybabtu::base64::selected_simd()));
+}
+
 TEST(test_base64, know_results)
 {
     std::string encoding_expectation = "Z2QAH6y0AoAt2AiAAAADAIAAABgHjBlQ";
@@ -144,3 +188,1009 @@ TEST(test_base64, invalid_string)
     check_fail("aaaa=aaa");
     check_fail("aaaaaa=a");
 }
+
+TEST(test_base64, url_known_results)
+{
+    std::vector<uint8_t> data = {0xfb, 0xff};
+
+    EXPECT_EQ("-_8=", aybabtu::base64::encode(data.data(), data.size(),
+                                              aybabtu::alphabet::url));
+    EXPECT_EQ("-_8", aybabtu::base64::encode(data.data(), data.size(),
+                                             aybabtu::alphabet::url,
+                                             aybabtu::padding::disabled));
+    EXPECT_EQ("+/8=", aybabtu::base64::encode(data.data(), data.size()));
+
+    for (const std::string& encoded :
+         std::initializer_list<std::string>{"-_8=", "-_8"})
+    {
+        auto padding = encoded.size() == 4 ? aybabtu::padding::enabled
+                                           : aybabtu::padding::disabled;
+        std::vector<uint8_t> decoded(
+            aybabtu::base64::decode_size(encoded, padding));
+        std::error_code error;
+        aybabtu::base64::decode(encoded, decoded.data(), error,
+                                aybabtu::alphabet::url, padding);
+        EXPECT_FALSE((bool)error);
+        EXPECT_EQ(data, decoded);
+    }
+}
+
+TEST(test_base64, url_invalid_string)
+{
+    auto check_fail = [](const std::string& bad_base64,
+                         aybabtu::padding padding)
+    {
+        std::vector<uint8_t> decoded(bad_base64.size());
+        std::error_code error;
+        aybabtu::base64::decode(bad_base64, decoded.data(), error,
+                                aybabtu::alphabet::url, padding);
+        EXPECT_TRUE((bool)error) << bad_base64;
+    };
+
+    // The characters of the standard alphabet are rejected:
+    check_fail("+aaa", aybabtu::padding::enabled);
+    check_fail("aaa/", aybabtu::padding::enabled);
+
+    // Padding is rejected when disabled, and required when enabled:
+    check_fail("aa==", aybabtu::padding::disabled);
+    check_fail("aaa=", aybabtu::padding::disabled);
+    check_fail("aa", aybabtu::padding::enabled);
+    check_fail("aaaaa", aybabtu::padding::disabled);
+}
+
+// Break an encoded string into lines, like MIME and PEM do
+static std::string wrap(const std::string& encoded, std::size_t columns,
+                        const std::string& newline)
+{
+    std::string result;
+    for (std::size_t i = 0; i < encoded.size(); i += columns)
+    {
+        if (i > 0)
+        {
+            result += newline;
+        }
+        result += encoded.substr(i, columns);
+    }
+    return result;
+}
+
+static void test_decode_whitespace(const std::string& wrapped,
+                                   const std::vector<uint8_t>& data,
+                                   aybabtu::alphabet alphabet,
+                                   aybabtu::padding padding,
+                                   aybabtu::simd simd)
+{
+    std::vector<uint8_t> decoded(
+        aybabtu::base64::decode_size(wrapped, aybabtu::padding::disabled));
+    std::error_code error;
+    auto written = aybabtu::base64::decode(wrapped, decoded.data(), error,
+                                           alphabet, padding,
+                                           aybabtu::whitespace::ignore, simd);
+    ASSERT_FALSE((bool)error);
+    ASSERT_EQ(data.size(), written);
+    decoded.resize(written);
+    EXPECT_EQ(data, decoded);
+}
+
+TEST(test_base64, decode_whitespace)
+{
+    for (auto simd : supported_simd())
+    {
+        SCOPED_TRACE(testing::Message() << "simd: " << (int)simd);
+
+        for (uint32_t i = 0; i < 50; ++i)
+        {
+            // Up to several blocks of whitespace removal:
+            std::vector<uint8_t> data(1 + rand() % 20000);
+            std::generate(data.begin(), data.end(), rand);
+            SCOPED_TRACE(testing::Message() << "size: " << data.size());
+
+            for (auto alphabet :
+                 {aybabtu::alphabet::standard, aybabtu::alphabet::url})
+            {
+                for (auto padding :
+                     {aybabtu::padding::enabled, aybabtu::padding::disabled})
+                {
+                    auto encoded = aybabtu::base64::encode(
+                        data.data(), data.size(), alphabet, padding,
+                        aybabtu::simd::none);
+
+                    test_decode_whitespace(encoded, data, alphabet, padding,
+                                           simd);
+                    test_decode_whitespace(wrap(encoded, 64, "\n"), data,
+                                           alphabet, padding, simd);
+                    test_decode_whitespace(wrap(encoded, 76, "\r\n") + "\r\n",
+                                           data,
+                                           alphabet, padding, simd);
+                    test_decode_whitespace(wrap(encoded, 1 + rand() % 100,
+                                                " \t\v\f"),
+                                           data, alphabet, padding, simd);
+                }
+            }
+
+            // A custom alphabet goes through the same code:
+            aybabtu::custom_alphabet alphabet(
+                "./0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                "abcdefghijklmnopqrstuvwxyz");
+            auto encoded = aybabtu::base64::encode(data.data(), data.size(),
+                                                   alphabet);
+            std::vector<uint8_t> decoded(aybabtu::base64::decode_size(
+                encoded, aybabtu::padding::disabled));
+            std::error_code error;
+            auto written = aybabtu::base64::decode(
+                wrap(encoded, 76, "\r\n"), decoded.data(), error, alphabet,
+                aybabtu::padding::enabled, aybabtu::whitespace::ignore, simd);
+            ASSERT_FALSE((bool)error);
+            decoded.resize(written);
+            EXPECT_EQ(data, decoded);
+        }
+    }
+}
+
+TEST(test_base64, decode_whitespace_padding)
+{
+    std::vector<uint8_t> data = {0xfb, 0xff};
+
+    for (const std::string& encoded : std::initializer_list<std::string>{
+             "+/8=\r\n", " +/8=", "+/\n8\n=\n", "+ / 8 =", "\t+/8=\t\n"})
+    {
+        std::vector<uint8_t> decoded(encoded.size());
+        std::error_code error;
+        auto written = aybabtu::base64::decode(
+            encoded, decoded.data(), error, aybabtu::alphabet::standard,
+            aybabtu::padding::enabled, aybabtu::whitespace::ignore);
+        ASSERT_FALSE((bool)error) << encoded;
+        decoded.resize(written);
+        EXPECT_EQ(data, decoded);
+    }
+
+    auto check_fail = [](const std::string& bad_base64,
+                         aybabtu::padding padding,
+                         aybabtu::whitespace whitespace)
+    {
+        std::vector<uint8_t> decoded(bad_base64.size());
+        std::error_code error;
+        aybabtu::base64::decode(bad_base64, decoded.data(), error,
+                                aybabtu::alphabet::standard, padding,
+                                whitespace);
+        EXPECT_TRUE((bool)error) << bad_base64;
+    };
+
+    // Whitespace is still rejected by default:
+    check_fail("+/8=\n", aybabtu::padding::enabled,
+               aybabtu::whitespace::reject);
+    check_fail("+/\n8", aybabtu::padding::disabled,
+               aybabtu::whitespace::reject);
+
+    // The characters without whitespace must still be a valid string:
+    check_fail("+/8\n", aybabtu::padding::enabled,
+               aybabtu::whitespace::ignore);
+    check_fail("+/=\n8", aybabtu::padding::enabled,
+               aybabtu::whitespace::ignore);
+    check_fail("+/8=\n", aybabtu::padding::disabled,
+               aybabtu::whitespace::ignore);
+    check_fail("+/8-\n", aybabtu::padding::disabled,
+               aybabtu::whitespace::ignore);
+}
+
+TEST(test_base64, encode_line_break)
+{
+    aybabtu::custom_alphabet custom(
+        "./0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+        "abcdefghijklmnopqrstuvwxyz");
+
+    for (auto simd : supported_simd())
+    {
+        SCOPED_TRACE(testing::Message() << "simd: " << (int)simd);
+
+        for (uint32_t i = 0; i < 50; ++i)
+        {
+            // Up to several blocks, and lines that span two blocks:
+            std::vector<uint8_t> data(1 + rand() % 10000);
+            std::generate(data.begin(), data.end(), rand);
+            std::size_t line_length = 1 + rand() % 100;
+            SCOPED_TRACE(testing::Message() << "size: " << data.size()
+                                            << " line: " << line_length);
+
+            for (auto padding :
+                 {aybabtu::padding::enabled, aybabtu::padding::disabled})
+            {
+                auto encoded = aybabtu::base64::encode(
+                    data.data(), data.size(), aybabtu::alphabet::url, padding,
+                    aybabtu::simd::none);
+
+                for (std::size_t length : {std::size_t{64}, std::size_t{76},
+                                           line_length})
+                {
+                    auto pem = aybabtu::base64::encode(
+                        data.data(), data.size(), aybabtu::alphabet::url,
+                        padding, length, aybabtu::line_break::lf, simd);
+                    EXPECT_EQ(wrap(encoded, length, "\n"), pem);
+                    EXPECT_EQ(aybabtu::base64::encode_size(
+                                  data.size(), padding, length,
+                                  aybabtu::line_break::lf),
+                              pem.size());
+
+                    auto mime = aybabtu::base64::encode(
+                        data.data(), data.size(), aybabtu::alphabet::url,
+                        padding, length, aybabtu::line_break::crlf, simd);
+                    EXPECT_EQ(wrap(encoded, length, "\r\n"), mime);
+                    EXPECT_EQ(aybabtu::base64::encode_size(
+                                  data.size(), padding, length,
+                                  aybabtu::line_break::crlf),
+                              mime.size());
+                }
+            }
+
+            auto encoded =
+                aybabtu::base64::encode(data.data(), data.size(), custom);
+            EXPECT_EQ(wrap(encoded, line_length, "\r\n"),
+                      aybabtu::base64::encode(
+                          data.data(), data.size(), custom,
+                          aybabtu::padding::enabled, line_length,
+                          aybabtu::line_break::crlf, simd));
+        }
+    }
+
+    // The line breaks are only between lines:
+    EXPECT_EQ(0U, aybabtu::base64::encode_size(0, aybabtu::padding::enabled,
+                                               4, aybabtu::line_break::crlf));
+    EXPECT_EQ(4U, aybabtu::base64::encode_size(3, aybabtu::padding::enabled,
+                                               4, aybabtu::line_break::crlf));
+    EXPECT_EQ(10U, aybabtu::base64::encode_size(
+                       6, aybabtu::padding::enabled, 4,
+                       aybabtu::line_break::crlf));
+    EXPECT_EQ(10U, aybabtu::base64::encode_size(
+                       6, aybabtu::padding::enabled, 3,
+                       aybabtu::line_break::lf));
+}
+
+TEST(test_base64, encode_line_length_zero)
+{
+    // A line length of 0 means no line breaks at all:
+    std::vector<uint8_t> data(1000);
+    std::generate(data.begin(), data.end(), rand);
+    aybabtu::custom_alphabet custom(
+        "./0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+        "abcdefghijklmnopqrstuvwxyz");
+
+    for (auto padding : {aybabtu::padding::enabled, aybabtu::padding::disabled})
+    {
+        EXPECT_EQ(aybabtu::base64::encode_size(data.size(), padding),
+                  aybabtu::base64::encode_size(data.size(), padding, 0,
+                                               aybabtu::line_break::crlf));
+        EXPECT_EQ(aybabtu::base64::encode(data.data(), data.size(),
+                                          aybabtu::alphabet::standard,
+                                          padding),
+                  aybabtu::base64::encode(data.data(), data.size(),
+                                          aybabtu::alphabet::standard,
+                                          padding, 0,
+                                          aybabtu::line_break::lf));
+        EXPECT_EQ(
+            aybabtu::base64::encode(data.data(), data.size(), custom, padding),
+            aybabtu::base64::encode(data.data(), data.size(), custom, padding,
+                                    0, aybabtu::line_break::crlf));
+    }
+}
+
+TEST(test_base64, threads)
+{
+    const std::size_t threshold = aybabtu::base64::thread_threshold();
+    aybabtu::base64::set_threads(4);
+    aybabtu::base64::set_thread_threshold(1000);
+    EXPECT_EQ(4U, aybabtu::base64::threads());
+    EXPECT_EQ(1000U, aybabtu::base64::thread_threshold());
+
+    aybabtu::custom_alphabet custom(
+        "./0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+        "abcdefghijklmnopqrstuvwxyz");
+
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        // Sizes that leave the last slices short or empty:
+        std::vector<uint8_t> data(1 + rand() % 20000);
+        std::generate(data.begin(), data.end(), rand);
+        SCOPED_TRACE(testing::Message() << "size: " << data.size());
+
+        for (auto padding :
+             {aybabtu::padding::enabled, aybabtu::padding::disabled})
+        {
+            auto expected = aybabtu::base64::encode(
+                data.data(), data.size(), aybabtu::alphabet::url, padding,
+                aybabtu::simd::none);
+
+            aybabtu::base64::set_threads(1);
+            auto encoded = aybabtu::base64::encode(
+                data.data(), data.size(), aybabtu::alphabet::url, padding);
+            EXPECT_EQ(expected, encoded);
+            aybabtu::base64::set_threads(4);
+            encoded = aybabtu::base64::encode(data.data(), data.size(),
+                                              aybabtu::alphabet::url, padding);
+            EXPECT_EQ(expected, encoded);
+
+            std::vector<uint8_t> decoded(
+                aybabtu::base64::decode_size(encoded, padding));
+            std::error_code error;
+            auto written = aybabtu::base64::decode(
+                encoded, decoded.data(), error, aybabtu::alphabet::url,
+                padding);
+            ASSERT_FALSE((bool)error);
+            EXPECT_EQ(decoded.size(), written);
+            EXPECT_EQ(data, decoded);
+
+            // Wrapped lines, of lengths that hold whole groups or not:
+            std::size_t columns = 1 + rand() % 100;
+            for (auto line_break :
+                 {aybabtu::line_break::lf, aybabtu::line_break::crlf})
+            {
+                const char* newline =
+                    line_break == aybabtu::line_break::crlf ? "\r\n" : "\n";
+                encoded = aybabtu::base64::encode(
+                    data.data(), data.size(), aybabtu::alphabet::url, padding,
+                    columns, line_break);
+                EXPECT_EQ(wrap(expected, columns, newline), encoded);
+
+                encoded = aybabtu::base64::encode(data.data(), data.size(),
+                                                  custom, padding, columns,
+                                                  line_break);
+                EXPECT_EQ(wrap(aybabtu::base64::encode(data.data(),
+                                                       data.size(), custom,
+                                                       padding,
+                                                       aybabtu::simd::none),
+                               columns, newline),
+                          encoded);
+            }
+        }
+
+        auto encoded =
+            aybabtu::base64::encode(data.data(), data.size(), custom);
+        std::vector<uint8_t> decoded(aybabtu::base64::decode_size(encoded));
+        std::error_code error;
+        aybabtu::base64::decode(encoded, decoded.data(), error, custom);
+        ASSERT_FALSE((bool)error);
+        EXPECT_EQ(data, decoded);
+
+        // An invalid character is found in any slice, and the first one is
+        // reported:
+        std::size_t first = rand() % encoded.size();
+        std::size_t second = first + rand() % (encoded.size() - first);
+        encoded[first] = '!';
+        encoded[second] = '!';
+        std::size_t error_offset = 0;
+        aybabtu::base64::decode(encoded.data(), encoded.size(),
+                                decoded.data(), error, error_offset, custom,
+                                aybabtu::padding::enabled,
+                                aybabtu::simd::none);
+        EXPECT_TRUE((bool)error);
+        EXPECT_EQ(first, error_offset);
+    }
+
+    aybabtu::base64::set_threads(1);
+    aybabtu::base64::set_thread_threshold(threshold);
+    EXPECT_EQ(1U, aybabtu::base64::threads());
+}
+
+TEST(test_base64, batch)
+{
+    aybabtu::custom_alphabet custom(
+        "./0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+        "abcdefghijklmnopqrstuvwxyz");
+
+    // A column of values from 0 to 200 bytes, starting at a non-zero offset
+    // as in a slice of an Arrow array:
+    std::vector<uint32_t> offsets = {5};
+    for (uint32_t i = 0; i < 500; ++i)
+    {
+        offsets.push_back(offsets.back() + rand() % 201);
+    }
+    const std::size_t count = offsets.size() - 1;
+    std::vector<uint8_t> data(offsets.back());
+    std::generate(data.begin(), data.end(), rand);
+
+    for (auto padding :
+         {aybabtu::padding::enabled, aybabtu::padding::disabled})
+    {
+        std::vector<char> column(aybabtu::base64::encode_batch_size(
+            offsets.data(), count, padding));
+        std::vector<uint32_t> column_offsets(count + 1);
+        std::error_code error;
+        auto size = aybabtu::base64::encode_batch(
+            data.data(), offsets.data(), count, column.data(),
+            column_offsets.data(), error, aybabtu::alphabet::url, padding);
+        ASSERT_FALSE((bool)error);
+        EXPECT_EQ(column.size(), size);
+        EXPECT_EQ(0U, column_offsets[0]);
+        EXPECT_EQ(size, column_offsets[count]);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            EXPECT_EQ(aybabtu::base64::encode(
+                          data.data() + offsets[i], offsets[i + 1] - offsets[i],
+                          aybabtu::alphabet::url, padding),
+                      std::string(column.data() + column_offsets[i],
+                                  column.data() + column_offsets[i + 1]));
+        }
+
+        std::vector<uint8_t> decoded(aybabtu::base64::decode_batch_size(
+            column.data(), column_offsets.data(), count, padding));
+        std::vector<uint32_t> decoded_offsets(count + 1);
+        size = aybabtu::base64::decode_batch(
+            column.data(), column_offsets.data(), count, decoded.data(),
+            decoded_offsets.data(), error, aybabtu::alphabet::url, padding);
+        ASSERT_FALSE((bool)error);
+        EXPECT_EQ(decoded.size(), size);
+        for (std::size_t i = 0; i <= count; ++i)
+        {
+            EXPECT_EQ(offsets[i] - offsets[0], decoded_offsets[i]);
+        }
+        EXPECT_TRUE(std::equal(decoded.begin(), decoded.end(),
+                               data.begin() + offsets[0]));
+    }
+
+    // The custom alphabet and an invalid value:
+    std::vector<char> column(aybabtu::base64::encode_batch_size(
+        offsets.data(), count, aybabtu::padding::enabled));
+    std::vector<uint32_t> column_offsets(count + 1);
+    std::error_code error;
+    aybabtu::base64::encode_batch(data.data(), offsets.data(), count,
+                                  column.data(), column_offsets.data(), error,
+                                  custom);
+    ASSERT_FALSE((bool)error);
+
+    std::vector<uint8_t> decoded(data.size());
+    std::vector<uint32_t> decoded_offsets(count + 1);
+    auto size = aybabtu::base64::decode_batch(
+        column.data(), column_offsets.data(), count, decoded.data(),
+        decoded_offsets.data(), error, custom);
+    ASSERT_FALSE((bool)error);
+    EXPECT_EQ(data.size() - offsets[0], size);
+    EXPECT_TRUE(std::equal(decoded.begin(), decoded.begin() + size,
+                           data.begin() + offsets[0]));
+
+    const std::size_t bad = column.size() / 2;
+    column[bad] = '+';
+    std::size_t error_index = 0;
+    aybabtu::base64::decode_batch(column.data(), column_offsets.data(), count,
+                                  decoded.data(), decoded_offsets.data(), error,
+                                  error_index, custom,
+                                  aybabtu::padding::enabled,
+                                  aybabtu::simd::none);
+    EXPECT_TRUE((bool)error);
+    ASSERT_LT(error_index, count);
+    EXPECT_LE(column_offsets[error_index], bad);
+    EXPECT_GT(column_offsets[error_index + 1], bad);
+}
+
+TEST(test_base64, batch_offset_overflow)
+{
+    // The second value, of 3 GiB, encodes to more than the 32-bit offsets
+    // can hold. The check comes before the value is read, so only the first
+    // value needs to exist.
+    std::vector<uint8_t> data(100);
+    std::vector<uint32_t> offsets = {0, 100, 100 + 0xC0000000U};
+    std::vector<char> column(aybabtu::base64::encode_size(100));
+    std::vector<uint32_t> column_offsets(3, 7);
+
+    std::error_code error;
+    auto size = aybabtu::base64::encode_batch(
+        data.data(), offsets.data(), 2, column.data(), column_offsets.data(),
+        error);
+    EXPECT_EQ(std::errc::value_too_large, error);
+    EXPECT_EQ(0U, size);
+    EXPECT_EQ(0U, column_offsets[0]);
+    EXPECT_EQ(column.size(), column_offsets[1]);
+    EXPECT_EQ(7U, column_offsets[2]);
+}
+
+TEST(test_base64, short_inputs)
+{
+    for (auto simd : supported_simd())
+    {
+        SCOPED_TRACE(testing::Message() << "simd: " << (int)simd);
+
+        for (auto alphabet :
+             {aybabtu::alphabet::standard, aybabtu::alphabet::url})
+        {
+            SCOPED_TRACE(testing::Message() << "alphabet: " << (int)alphabet);
+
+            // Every size up to a few rounds of the widest codec, so that
+            // every tail length is covered:
+            for (std::size_t size = 1; size < 300; ++size)
+            {
+                SCOPED_TRACE(testing::Message() << "size: " << size);
+                std::vector<uint8_t> data(size);
+                std::generate(data.begin(), data.end(), rand);
+
+                auto encoded = aybabtu::base64::encode(
+                    data.data(), size, alphabet, aybabtu::padding::enabled,
+                    simd);
+                EXPECT_EQ(aybabtu::base64::encode(data.data(), size, alphabet,
+                                                  aybabtu::padding::enabled,
+                                                  aybabtu::simd::none),
+                          encoded);
+
+                std::vector<uint8_t> decoded(size);
+                std::error_code error;
+                auto written = aybabtu::base64::decode(
+                    encoded, decoded.data(), error, alphabet,
+                    aybabtu::padding::enabled, simd);
+                ASSERT_FALSE((bool)error);
+                EXPECT_EQ(size, written);
+                EXPECT_EQ(data, decoded);
+
+                // An invalid character anywhere is found, including in the
+                // tail:
+                encoded[rand() % encoded.size()] = '*';
+                aybabtu::base64::decode(encoded, decoded.data(), error,
+                                        alphabet, aybabtu::padding::enabled,
+                                        simd);
+                EXPECT_TRUE((bool)error);
+            }
+        }
+    }
+}
+
+TEST(test_base64, validate)
+{
+    for (auto simd : supported_simd())
+    {
+        SCOPED_TRACE(testing::Message() << "simd: " << (int)simd);
+
+        for (auto alphabet :
+             {aybabtu::alphabet::standard, aybabtu::alphabet::url})
+        {
+            SCOPED_TRACE(testing::Message() << "alphabet: " << (int)alphabet);
+
+            for (std::size_t size = 1; size < 200; ++size)
+            {
+                SCOPED_TRACE(testing::Message() << "size: " << size);
+                std::vector<uint8_t> data(size);
+                std::generate(data.begin(), data.end(), rand);
+
+                for (auto padding :
+                     {aybabtu::padding::enabled, aybabtu::padding::disabled})
+                {
+                    auto encoded = aybabtu::base64::encode(
+                        data.data(), size, alphabet, padding, simd);
+                    EXPECT_TRUE(aybabtu::base64::is_valid(encoded, alphabet,
+                                                          padding, simd));
+
+                    // Agree with the decoder on a string with a character
+                    // replaced anywhere by a character of either alphabet,
+                    // padding or an invalid character:
+                    const char replacements[] = {'A', '+', '-', '=',
+                                                 '*', '\0', '\xFF'};
+                    for (char c : replacements)
+                    {
+                        std::string modified = encoded;
+                        modified[rand() % modified.size()] = c;
+
+                        std::vector<uint8_t> decoded(size + 3);
+                        std::error_code decode_error;
+                        aybabtu::base64::decode(modified, decoded.data(),
+                                                decode_error, alphabet,
+                                                padding, simd);
+
+                        std::error_code error;
+                        aybabtu::base64::validate(modified.data(),
+                                                  modified.size(), error,
+                                                  alphabet, padding, simd);
+                        EXPECT_EQ((bool)decode_error, (bool)error)
+                            << modified;
+                        EXPECT_EQ(!decode_error,
+                                  aybabtu::base64::is_valid(
+                                      modified, alphabet, padding, simd));
+                    }
+                }
+            }
+        }
+
+        // Strings that are invalid because of their size or padding:
+        const auto standard = aybabtu::alphabet::standard;
+        const auto enabled = aybabtu::padding::enabled;
+        const auto disabled = aybabtu::padding::disabled;
+        EXPECT_FALSE(
+            aybabtu::base64::is_valid("QUJD=", standard, enabled, simd));
+        EXPECT_FALSE(
+            aybabtu::base64::is_valid("QUJDR", standard, disabled, simd));
+        EXPECT_FALSE(
+            aybabtu::base64::is_valid("QUJDRA", standard, enabled, simd));
+        EXPECT_FALSE(
+            aybabtu::base64::is_valid("QQ==", standard, disabled, simd));
+        EXPECT_FALSE(
+            aybabtu::base64::is_valid("Q===", standard, enabled, simd));
+        EXPECT_TRUE(aybabtu::base64::is_valid("QQ==", standard, enabled, simd));
+        EXPECT_TRUE(aybabtu::base64::is_valid("", standard, enabled, simd));
+    }
+}
+
+TEST(test_base64, error_offset)
+{
+    for (auto simd : supported_simd())
+    {
+        SCOPED_TRACE(testing::Message() << "simd: " << (int)simd);
+
+        for (auto padding :
+             {aybabtu::padding::enabled, aybabtu::padding::disabled})
+        {
+            std::vector<uint8_t> data(300);
+            std::generate(data.begin(), data.end(), rand);
+            const auto encoded = aybabtu::base64::encode(
+                data.data(), data.size(), aybabtu::alphabet::standard,
+                padding, simd);
+            std::vector<uint8_t> decoded(data.size());
+
+            // An invalid character at every position, followed by a second
+            // one somewhere after it:
+            for (std::size_t i = 0; i < encoded.size(); ++i)
+            {
+                for (char c : {'*', '=', '\x80'})
+                {
+                    std::string modified = encoded;
+                    modified[i] = c;
+                    modified[i + rand() % (encoded.size() - i)] = '*';
+
+                    std::error_code error;
+                    std::size_t error_offset = 0;
+                    auto written = aybabtu::base64::decode(
+                        modified.data(), modified.size(), decoded.data(),
+                        error, error_offset, aybabtu::alphabet::standard,
+                        padding, simd);
+                    EXPECT_TRUE((bool)error) << i;
+                    EXPECT_EQ(i, error_offset);
+                    EXPECT_EQ(0U, written);
+                }
+            }
+        }
+
+        // Strings that are invalid because of their size report their size:
+        std::vector<uint8_t> decoded(8);
+        for (auto test : {std::make_pair("QUJD=", aybabtu::padding::enabled),
+                          std::make_pair("QUJDR", aybabtu::padding::disabled),
+                          std::make_pair("QUJDRA", aybabtu::padding::enabled)})
+        {
+            std::error_code error;
+            std::size_t error_offset = 0;
+            std::size_t size = std::strlen(test.first);
+            aybabtu::base64::decode(test.first, size, decoded.data(), error,
+                                    error_offset, aybabtu::alphabet::standard,
+                                    test.second, simd);
+            EXPECT_TRUE((bool)error) << test.first;
+            EXPECT_EQ(size, error_offset) << test.first;
+        }
+
+        // Padding that does not end the string is invalid where it starts:
+        std::error_code error;
+        std::size_t error_offset = 0;
+        aybabtu::base64::decode("QQ==QUJD", 8, decoded.data(), error,
+                                error_offset, aybabtu::alphabet::standard,
+                                aybabtu::padding::enabled, simd);
+        EXPECT_TRUE((bool)error);
+        EXPECT_EQ(2U, error_offset);
+
+        error = std::error_code();
+        aybabtu::base64::decode("Q===", 4, decoded.data(), error, error_offset,
+                                aybabtu::alphabet::standard,
+                                aybabtu::padding::enabled, simd);
+        EXPECT_TRUE((bool)error);
+        EXPECT_EQ(1U, error_offset);
+    }
+}
+
+TEST(test_base64, append)
+{
+    aybabtu::custom_alphabet custom(
+        "./0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+        "abcdefghijklmnopqrstuvwxyz");
+
+    std::string encoded;
+    std::vector<uint8_t> decoded;
+
+    for (auto padding :
+         {aybabtu::padding::enabled, aybabtu::padding::disabled})
+    {
+        for (std::size_t size = 1; size < 100; ++size)
+        {
+            SCOPED_TRACE(testing::Message() << "size: " << size);
+            std::vector<uint8_t> data(size);
+            std::generate(data.begin(), data.end(), rand);
+
+            const auto expected = aybabtu::base64::encode(
+                data.data(), size, aybabtu::alphabet::url, padding);
+            encoded = "prefix";
+            EXPECT_EQ(expected.size(),
+                      aybabtu::base64::encode_append(data.data(), size,
+                                                     encoded,
+                                                     aybabtu::alphabet::url,
+                                                     padding));
+            EXPECT_EQ("prefix" + expected, encoded);
+
+            decoded = {1, 2, 3};
+            std::error_code error;
+            EXPECT_EQ(size, aybabtu::base64::decode_append(
+                                encoded.data() + 6, encoded.size() - 6,
+                                decoded, error, aybabtu::alphabet::url,
+                                padding));
+            ASSERT_FALSE((bool)error);
+            ASSERT_EQ(size + 3, decoded.size());
+            EXPECT_EQ(0, memcmp(data.data(), decoded.data() + 3, size));
+
+            // A custom alphabet:
+            encoded.clear();
+            aybabtu::base64::encode_append(data.data(), size, encoded, custom,
+                                           padding);
+            EXPECT_EQ(
+                aybabtu::base64::encode(data.data(), size, custom, padding),
+                encoded);
+            decoded.clear();
+            aybabtu::base64::decode_append(encoded.data(), encoded.size(),
+                                           decoded, error, custom, padding);
+            ASSERT_FALSE((bool)error);
+            EXPECT_EQ(data, decoded);
+        }
+    }
+
+    // A reused buffer is not reallocated:
+    std::vector<uint8_t> data(1000, 'x');
+    encoded.clear();
+    aybabtu::base64::encode_append(data.data(), data.size(), encoded);
+    const char* characters = encoded.data();
+    encoded.clear();
+    aybabtu::base64::encode_append(data.data(), data.size(), encoded);
+    EXPECT_EQ(characters, encoded.data());
+
+    decoded.clear();
+    std::error_code error;
+    aybabtu::base64::decode_append(encoded, decoded, error);
+    const uint8_t* bytes = decoded.data();
+    decoded.clear();
+    aybabtu::base64::decode_append(encoded, decoded, error);
+    EXPECT_FALSE((bool)error);
+    EXPECT_EQ(bytes, decoded.data());
+    EXPECT_EQ(data, decoded);
+
+    // On an error the vector keeps its size:
+    aybabtu::base64::decode_append("QUJD*A==", 8, decoded, error);
+    EXPECT_TRUE((bool)error);
+    EXPECT_EQ(data, decoded);
+    error = std::error_code();
+    aybabtu::base64::decode_append("QUJDR", 5, decoded, error);
+    EXPECT_TRUE((bool)error);
+    EXPECT_EQ(data, decoded);
+}
+
+TEST(test_base64, selected_simd)
+{
+    for (auto simd : supported_simd())
+    {
+        auto selected = aybabtu::base64::selected_simd(simd);
+        EXPECT_NE(aybabtu::simd::auto_, selected);
+        if (simd != aybabtu::simd::auto_)
+        {
+            EXPECT_EQ(simd, selected);
+        }
+    }
+    EXPECT_EQ(aybabtu::base64::selected_simd(),
+              aybabtu::base64::selected_simd(aybabtu::simd::auto_));
+}
+
+TEST(test_base64, decode_inplace)
+{
+    aybabtu::custom_alphabet custom(
+        "./0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+        "abcdefghijklmnopqrstuvwxyz");
+
+    for (auto simd : supported_simd())
+    {
+        SCOPED_TRACE(testing::Message() << "simd: " << (int)simd);
+
+        for (auto padding :
+             {aybabtu::padding::enabled, aybabtu::padding::disabled})
+        {
+            // Every size around the head that is decoded into a buffer and
+            // every tail length of the widest codec, and a few large ones:
+            std::vector<std::size_t> sizes;
+            for (std::size_t size = 1; size < 300; ++size)
+            {
+                sizes.push_back(size);
+            }
+            sizes.push_back(10000);
+            sizes.push_back(100000 + rand() % 1000);
+
+            for (std::size_t size : sizes)
+            {
+                SCOPED_TRACE(testing::Message() << "size: " << size);
+                std::vector<uint8_t> data(size);
+                std::generate(data.begin(), data.end(), rand);
+
+                auto encoded = aybabtu::base64::encode(
+                    data.data(), size, aybabtu::alphabet::url, padding, simd);
+                std::error_code error;
+                auto written = aybabtu::base64::decode_inplace(
+                    &encoded[0], encoded.size(), error,
+                    aybabtu::alphabet::url, padding, simd);
+                ASSERT_FALSE((bool)error);
+                ASSERT_EQ(size, written);
+                EXPECT_EQ(0, memcmp(data.data(), encoded.data(), size));
+
+                encoded = aybabtu::base64::encode(data.data(), size, custom,
+                                                  padding, simd);
+                written = aybabtu::base64::decode_inplace(
+                    &encoded[0], encoded.size(), error, custom, padding, simd);
+                ASSERT_FALSE((bool)error);
+                ASSERT_EQ(size, written);
+                EXPECT_EQ(0, memcmp(data.data(), encoded.data(), size));
+
+                // An invalid character anywhere is found:
+                encoded = aybabtu::base64::encode(
+                    data.data(), size, aybabtu::alphabet::standard, padding,
+                    simd);
+                encoded[rand() % encoded.size()] = '*';
+                aybabtu::base64::decode_inplace(&encoded[0], encoded.size(),
+                                                error,
+                                                aybabtu::alphabet::standard,
+                                                padding, simd);
+                EXPECT_TRUE((bool)error);
+            }
+        }
+    }
+
+    char empty[] = "";
+    std::error_code error;
+    EXPECT_EQ(0U, aybabtu::base64::decode_inplace(empty, 0, error));
+    EXPECT_FALSE((bool)error);
+
+    // The data of an empty vector may be null:
+    std::vector<char> none;
+    EXPECT_EQ(0U, aybabtu::base64::decode_inplace(none.data(), 0, error));
+    EXPECT_FALSE((bool)error);
+    EXPECT_EQ(0U, aybabtu::base64::decode_inplace(nullptr, 0, error, custom));
+    EXPECT_FALSE((bool)error);
+}
+
+TEST(test_base64, encode_inplace)
+{
+    aybabtu::custom_alphabet custom(
+        "./0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+        "abcdefghijklmnopqrstuvwxyz");
+
+    for (auto simd : supported_simd())
+    {
+        SCOPED_TRACE(testing::Message() << "simd: " << (int)simd);
+
+        for (auto padding :
+             {aybabtu::padding::enabled, aybabtu::padding::disabled})
+        {
+            // Every tail length of the reverse loops, and a few large ones:
+            std::vector<std::size_t> sizes;
+            for (std::size_t size = 1; size < 300; ++size)
+            {
+                sizes.push_back(size);
+            }
+            sizes.push_back(10000);
+            sizes.push_back(100000 + rand() % 1000);
+
+            for (std::size_t size : sizes)
+            {
+                SCOPED_TRACE(testing::Message() << "size: " << size);
+                std::vector<uint8_t> data(size);
+                std::generate(data.begin(), data.end(), rand);
+
+                // The buffer is exactly as large as the encoded string:
+                const std::size_t capacity =
+                    aybabtu::base64::encode_size(size, padding);
+
+                for (auto alphabet :
+                     {aybabtu::alphabet::standard, aybabtu::alphabet::url})
+                {
+                    std::vector<uint8_t> buffer(data);
+                    buffer.resize(capacity);
+                    auto written = aybabtu::base64::encode_inplace(
+                        buffer.data(), size, capacity, alphabet, padding,
+                        simd);
+                    ASSERT_EQ(capacity, written);
+                    EXPECT_EQ(aybabtu::base64::encode(data.data(), size,
+                                                      alphabet, padding, simd),
+                              std::string(buffer.begin(), buffer.end()));
+                }
+
+                std::vector<uint8_t> buffer(data);
+                buffer.resize(capacity);
+                auto written = aybabtu::base64::encode_inplace(
+                    buffer.data(), size, capacity, custom, padding, simd);
+                ASSERT_EQ(capacity, written);
+                EXPECT_EQ(aybabtu::base64::encode(data.data(), size, custom,
+                                                  padding, simd),
+                          std::string(buffer.begin(), buffer.end()));
+            }
+        }
+    }
+
+    EXPECT_EQ(0U, aybabtu::base64::encode_inplace(nullptr, 0, 0));
+
+    // A buffer too small for the encoded string is rejected before it is
+    // written:
+    std::vector<uint8_t> data = {1, 2, 3, 4};
+    std::vector<uint8_t> buffer(data);
+    buffer.resize(aybabtu::base64::encode_size(data.size()) - 1);
+    EXPECT_THROW(aybabtu::base64::encode_inplace(buffer.data(), data.size(),
+                                                 buffer.size()),
+                 std::invalid_argument);
+    EXPECT_THROW(aybabtu::base64::encode_inplace(
+                     buffer.data(), data.size(), buffer.size(), custom),
+                 std::invalid_argument);
+    EXPECT_EQ(data, std::vector<uint8_t>(buffer.begin(),
+                                         buffer.begin() + data.size()));
+
+    // Without padding the string is shorter:
+    EXPECT_EQ(buffer.size() - 1,
+              aybabtu::base64::encode_inplace(
+                  buffer.data(), data.size(), buffer.size() - 1,
+                  aybabtu::alphabet::standard, aybabtu::padding::disabled));
+}
+
+TEST(test_base64, stream)
+{
+    const std::size_t threshold = aybabtu::base64::stream_threshold();
+    aybabtu::base64::set_stream_threshold(0);
+    EXPECT_EQ(0U, aybabtu::base64::stream_threshold());
+
+    for (auto simd : supported_simd())
+    {
+        SCOPED_TRACE(testing::Message() << "simd: " << (int)simd);
+
+        for (uint32_t i = 0; i < 200; ++i)
+        {
+            // Every output alignment, including ones that are not a multiple
+            // of 4 bytes from an aligned address:
+            std::size_t size = 1 + rand() % (i < 100 ? 600 : 20000);
+            std::size_t offset = rand() % 64;
+            SCOPED_TRACE(testing::Message()
+                         << "size: " << size << " offset: " << offset);
+
+            std::vector<uint8_t> data(size);
+            std::generate(data.begin(), data.end(), rand);
+
+            for (auto alphabet :
+                 {aybabtu::alphabet::standard, aybabtu::alphabet::url})
+            {
+                std::string encoded(
+                    aybabtu::base64::encode_size(size) + offset, '\0');
+                auto chars = aybabtu::base64::encode(
+                    data.data(), size, &encoded[offset], alphabet,
+                    aybabtu::padding::enabled, simd);
+                encoded.erase(0, offset);
+                ASSERT_EQ(encoded.size(), chars);
+                EXPECT_EQ(aybabtu::base64::encode(
+                              data.data(), size, alphabet,
+                              aybabtu::padding::enabled, aybabtu::simd::none),
+                          encoded);
+
+                std::vector<uint8_t> decoded(size + offset);
+                std::error_code error;
+                auto written = aybabtu::base64::decode(
+                    encoded, decoded.data() + offset, error, alphabet,
+                    aybabtu::padding::enabled, simd);
+                ASSERT_FALSE((bool)error);
+                ASSERT_EQ(size, written);
+                EXPECT_EQ(0,
+                          memcmp(data.data(), decoded.data() + offset, size));
+
+                // An invalid character is found in the streamed blocks too:
+                std::size_t bad =
+                    rand() % aybabtu::base64::encode_size(
+                                 size, aybabtu::padding::disabled);
+                encoded[bad] = '*';
+                std::size_t error_offset = 0;
+                aybabtu::base64::decode(encoded.data(), encoded.size(),
+                                        decoded.data() + offset, error,
+                                        error_offset, alphabet,
+                                        aybabtu::padding::enabled, simd);
+                EXPECT_TRUE((bool)error);
+                EXPECT_EQ(bad, error_offset);
+            }
+        }
+    }
+
+    aybabtu::base64::set_stream_threshold(threshold);
+}
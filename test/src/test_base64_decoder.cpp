@@ -0,0 +1,138 @@
+// Copyright (c) Steinwurf ApS 2016.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include <aybabtu/base64.hpp>
+#include <aybabtu/base64_decoder.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+// Decode the fragments, return the error offset or -1 on success
+static int decode_fragments(const std::vector<std::string>& fragments,
+                            std::vector<uint8_t>& decoded,
+                            aybabtu::simd simd = aybabtu::simd::auto_)
+{
+    aybabtu::base64_decoder decoder(simd);
+    std::error_code error;
+
+    for (const auto& fragment : fragments)
+    {
+        std::vector<uint8_t> out(decoder.update_size(fragment.size()));
+        auto written =
+            decoder.update(fragment.data(), fragment.size(), out.data(), error);
+        if (error)
+        {
+            return (int)decoder.error_offset();
+        }
+        decoded.insert(decoded.end(), out.begin(), out.begin() + written);
+    }
+
+    decoder.finish(error);
+    if (error)
+    {
+        return (int)decoder.error_offset();
+    }
+    return -1;
+}
+
+static void test_fragments(std::size_t size, std::size_t max_fragment,
+                           aybabtu::simd simd)
+{
+    SCOPED_TRACE(testing::Message() << "size: " << size);
+    SCOPED_TRACE(testing::Message() << "max_fragment: " << max_fragment);
+
+    std::vector<uint8_t> data(size);
+    std::generate(data.begin(), data.end(), rand);
+    auto encoded = aybabtu::base64::encode(data.data(), data.size(), simd);
+
+    std::vector<std::string> fragments;
+    std::size_t offset = 0;
+    while (offset < encoded.size())
+    {
+        std::size_t fragment = std::min<std::size_t>(
+            1 + rand() % max_fragment, encoded.size() - offset);
+        fragments.push_back(encoded.substr(offset, fragment));
+        offset += fragment;
+    }
+
+    std::vector<uint8_t> decoded;
+    EXPECT_EQ(-1, decode_fragments(fragments, decoded, simd));
+    EXPECT_EQ(data, decoded);
+}
+
+TEST(test_base64_decoder, fragments)
+{
+    for (auto simd : {aybabtu::simd::auto_, aybabtu::simd::none})
+    {
+        test_fragments(1, 1, simd);
+        test_fragments(2, 1, simd);
+        test_fragments(100, 1, simd);
+        test_fragments(1000, 7, simd);
+        test_fragments(10000, 1000, simd);
+
+        for (uint32_t i = 0; i < 100; ++i)
+        {
+            test_fragments(1 + rand() % 10000, 1 + rand() % 500, simd);
+        }
+    }
+}
+
+TEST(test_base64_decoder, padding)
+{
+    std::vector<uint8_t> decoded;
+    EXPECT_EQ(-1, decode_fragments({"QUJD", "QQ", "=", "="}, decoded));
+    EXPECT_EQ(std::vector<uint8_t>({'A', 'B', 'C', 'A'}), decoded);
+
+    decoded.clear();
+    EXPECT_EQ(-1, decode_fragments({"QUJDQU", "I="}, decoded));
+    EXPECT_EQ(std::vector<uint8_t>({'A', 'B', 'C', 'A', 'B'}), decoded);
+}
+
+TEST(test_base64_decoder, error_offset)
+{
+    std::vector<uint8_t> decoded;
+
+    // Invalid character in a buffered group:
+    EXPECT_EQ(6, decode_fragments({"QUJDQ", "U*D"}, decoded));
+
+    // Invalid character in the middle of a fragment:
+    EXPECT_EQ(9, decode_fragments({"QUJD", "QUJDQ*JD"}, decoded));
+
+    // Padding in the middle of the stream:
+    EXPECT_EQ(6, decode_fragments({"QUJDQQ==QUJD"}, decoded));
+
+    // Data after the padding:
+    EXPECT_EQ(4, decode_fragments({"QQ==", "QUJD"}, decoded));
+    EXPECT_EQ(4, decode_fragments({"QQ=", "=Q", "UJD"}, decoded));
+
+    // Stream ends inside a group:
+    EXPECT_EQ(7, decode_fragments({"QUJDQUJ"}, decoded));
+}
+
+TEST(test_base64_decoder, reset)
+{
+    aybabtu::base64_decoder decoder;
+    std::error_code error;
+    uint8_t out[3];
+
+    decoder.update("Q*JD", 4, out, error);
+    EXPECT_TRUE((bool)error);
+    EXPECT_EQ(1U, decoder.error_offset());
+
+    // The decoder stays failed until it is reset:
+    error.clear();
+    decoder.update("QUJD", 4, out, error);
+    EXPECT_TRUE((bool)error);
+
+    decoder.reset();
+    error.clear();
+    EXPECT_EQ(3U, decoder.update("QUJD", 4, out, error));
+    EXPECT_FALSE((bool)error);
+    decoder.finish(error);
+    EXPECT_FALSE((bool)error);
+}
@@ -0,0 +1,81 @@
+// Copyright (c) Steinwurf ApS 2016.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include <aybabtu/base64.hpp>
+#include <aybabtu/base64_encoder.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+static void test_chunks(std::size_t size, std::size_t max_chunk,
+                        aybabtu::simd simd)
+{
+    SCOPED_TRACE(testing::Message() << "size: " << size);
+    SCOPED_TRACE(testing::Message() << "max_chunk: " << max_chunk);
+
+    std::vector<uint8_t> data(size);
+    std::generate(data.begin(), data.end(), rand);
+
+    aybabtu::base64_encoder encoder(simd);
+    std::string encoded;
+
+    std::size_t offset = 0;
+    while (offset < size)
+    {
+        std::size_t chunk =
+            std::min<std::size_t>(1 + rand() % max_chunk, size - offset);
+        std::vector<char> out(encoder.update_size(chunk));
+        auto written = encoder.update(data.data() + offset, chunk, out.data());
+        EXPECT_EQ(out.size(), written);
+        encoded.append(out.data(), written);
+        offset += chunk;
+    }
+
+    char tail[aybabtu::base64_encoder::finish_size];
+    encoded.append(tail, encoder.finish(tail));
+
+    EXPECT_EQ(aybabtu::base64::encode(data.data(), data.size(), simd),
+              encoded);
+}
+
+TEST(test_base64_encoder, chunks)
+{
+    for (auto simd : {aybabtu::simd::auto_, aybabtu::simd::none})
+    {
+        test_chunks(1, 1, simd);
+        test_chunks(2, 1, simd);
+        test_chunks(100, 1, simd);
+        test_chunks(1000, 7, simd);
+        test_chunks(10000, 1000, simd);
+
+        for (uint32_t i = 0; i < 100; ++i)
+        {
+            test_chunks(1 + rand() % 10000, 1 + rand() % 500, simd);
+        }
+    }
+}
+
+TEST(test_base64_encoder, reuse)
+{
+    std::vector<uint8_t> data = {1, 2, 3, 4};
+
+    aybabtu::base64_encoder encoder;
+    std::vector<char> out(aybabtu::base64::encode_size(data.size()));
+
+    for (uint32_t i = 0; i < 2; ++i)
+    {
+        auto written = encoder.update(data.data(), data.size(), out.data());
+        written += encoder.finish(out.data() + written);
+        EXPECT_EQ("AQIDBA==", std::string(out.data(), written));
+    }
+
+    // A reset discards the buffered byte:
+    encoder.update(data.data(), 1, out.data());
+    encoder.reset();
+    EXPECT_EQ(0U, encoder.finish(out.data()));
+}
@@ -0,0 +1,223 @@
+// Copyright (c) Steinwurf ApS 2016.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include <aybabtu/base64.hpp>
+#include <aybabtu/custom_alphabet.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+static const std::string standard_characters =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static const std::string crypt_characters =
+    "./0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+
+// The accelerations that can be requested on this machine:
+static std::vector<aybabtu::simd> supported_simd()
+{
+    std::vector<aybabtu::simd> simds;
+    for (auto simd :
+         {aybabtu::simd::auto_, aybabtu::simd::none,
+          aybabtu::simd::avx512_vbmi, aybabtu::simd::avx512_bw,
+          aybabtu::simd::avx512_vl, aybabtu::simd::avx2, aybabtu::simd::ssse3,
+          aybabtu::simd::neon})
+    {
+        if (aybabtu::base64::is_supported(simd))
+        {
+            simds.push_back(simd);
+        }
+    }
+    return simds;
+}
+
+// Encode with the standard alphabet and translate the characters, which is
+// what a custom alphabet must produce.
+static std::string translate(const uint8_t* data, std::size_t size,
+                             const std::string& characters,
+                             aybabtu::padding padding)
+{
+    std::string result =
+        aybabtu::base64::encode(data, size, aybabtu::alphabet::standard,
+                                padding, aybabtu::simd::none);
+    for (char& c : result)
+    {
+        if (c != '=')
+        {
+            c = characters[standard_characters.find(c)];
+        }
+    }
+    return result;
+}
+
+static void test_encode_decode(const std::string& characters)
+{
+    aybabtu::custom_alphabet alphabet(characters);
+
+    for (auto simd : supported_simd())
+    {
+        SCOPED_TRACE(testing::Message() << "simd: " << (int)simd);
+
+        for (auto padding :
+             {aybabtu::padding::enabled, aybabtu::padding::disabled})
+        {
+            for (uint32_t i = 0; i < 100; ++i)
+            {
+                std::vector<uint8_t> data(1 + rand() % 1000);
+                std::generate(data.begin(), data.end(), rand);
+                SCOPED_TRACE(testing::Message() << "size: " << data.size());
+
+                auto encoded = aybabtu::base64::encode(
+                    data.data(), data.size(), alphabet, padding, simd);
+                EXPECT_EQ(translate(data.data(), data.size(), characters,
+                                    padding),
+                          encoded);
+
+                std::vector<uint8_t> decoded(
+                    aybabtu::base64::decode_size(encoded, padding));
+                std::error_code error;
+                auto written = aybabtu::base64::decode(
+                    encoded, decoded.data(), error, alphabet, padding, simd);
+                ASSERT_FALSE((bool)error);
+                EXPECT_EQ(decoded.size(), written);
+                EXPECT_EQ(data, decoded);
+                EXPECT_TRUE(aybabtu::base64::is_valid(encoded, alphabet,
+                                                      padding, simd));
+            }
+        }
+    }
+}
+
+TEST(test_custom_alphabet, is_valid)
+{
+    EXPECT_TRUE(aybabtu::custom_alphabet::is_valid(standard_characters));
+    EXPECT_TRUE(aybabtu::custom_alphabet::is_valid(crypt_characters));
+
+    // Too short, too long, repeated, padding, whitespace and non-ASCII
+    // characters:
+    EXPECT_FALSE(aybabtu::custom_alphabet::is_valid(""));
+    EXPECT_FALSE(
+        aybabtu::custom_alphabet::is_valid(standard_characters.substr(1)));
+    EXPECT_FALSE(aybabtu::custom_alphabet::is_valid(standard_characters + "-"));
+    EXPECT_FALSE(aybabtu::custom_alphabet::is_valid(
+        standard_characters.substr(1) + "B"));
+    EXPECT_FALSE(aybabtu::custom_alphabet::is_valid(
+        standard_characters.substr(1) + "="));
+    EXPECT_FALSE(aybabtu::custom_alphabet::is_valid(
+        standard_characters.substr(1) + "\xC3"));
+    for (const char* whitespace : {" ", "\t", "\n", "\v", "\f", "\r"})
+    {
+        EXPECT_FALSE(aybabtu::custom_alphabet::is_valid(
+            standard_characters.substr(1) + whitespace));
+    }
+}
+
+TEST(test_custom_alphabet, invalid_characters)
+{
+    EXPECT_THROW(aybabtu::custom_alphabet(""), std::invalid_argument);
+    EXPECT_THROW(aybabtu::custom_alphabet(standard_characters.substr(1) + "B"),
+                 std::invalid_argument);
+    EXPECT_THROW(aybabtu::custom_alphabet(standard_characters.substr(1) + "\n"),
+                 std::invalid_argument);
+    EXPECT_NO_THROW(aybabtu::custom_alphabet{crypt_characters});
+}
+
+TEST(test_custom_alphabet, tables)
+{
+    aybabtu::custom_alphabet alphabet(crypt_characters);
+    EXPECT_EQ(crypt_characters, alphabet.characters());
+
+    for (uint32_t c = 0; c < 256; ++c)
+    {
+        auto position = crypt_characters.find((char)c);
+        if (position != std::string::npos)
+        {
+            EXPECT_EQ(position, alphabet.decode_table()[c]);
+            EXPECT_EQ(c, alphabet.encode_table()[position]);
+        }
+        else
+        {
+            EXPECT_EQ(c == '=' ? 254U : 255U, alphabet.decode_table()[c]);
+        }
+    }
+}
+
+TEST(test_custom_alphabet, encode_decode)
+{
+    {
+        SCOPED_TRACE("standard");
+        test_encode_decode(standard_characters);
+    }
+    {
+        SCOPED_TRACE("crypt");
+        test_encode_decode(crypt_characters);
+    }
+    {
+        SCOPED_TRACE("imap");
+        test_encode_decode("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxy"
+                           "z0123456789+,");
+    }
+    {
+        // No ranges of consecutive characters at all:
+        std::string shuffled = crypt_characters;
+        std::reverse(shuffled.begin(), shuffled.end());
+        std::swap(shuffled[3], shuffled[40]);
+        std::swap(shuffled[17], shuffled[63]);
+        SCOPED_TRACE(shuffled);
+        test_encode_decode(shuffled);
+    }
+}
+
+TEST(test_custom_alphabet, invalid_string)
+{
+    aybabtu::custom_alphabet alphabet(crypt_characters);
+
+    for (auto simd : supported_simd())
+    {
+        SCOPED_TRACE(testing::Message() << "simd: " << (int)simd);
+
+        // Strings of every length are valid, including those that end in a
+        // partial vector:
+        for (std::size_t size = 0; size < 200; ++size)
+        {
+            std::string encoded;
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                encoded += crypt_characters[(i * 7 + size) % 64];
+            }
+            EXPECT_EQ(size % 4 != 1,
+                      aybabtu::base64::is_valid(
+                          encoded, alphabet, aybabtu::padding::disabled, simd))
+                << size;
+        }
+
+        // Place an invalid character at every position of a string long
+        // enough for every simd codec:
+        for (char bad : {'+', '=', '\x80', '\xFF', '\0'})
+        {
+            for (std::size_t i = 0; i < 200; ++i)
+            {
+                std::string encoded(200, 'a');
+                encoded[i] = bad;
+
+                std::vector<uint8_t> decoded(encoded.size());
+                std::error_code error;
+                aybabtu::base64::decode(encoded, decoded.data(), error,
+                                        alphabet, aybabtu::padding::disabled,
+                                        simd);
+                EXPECT_TRUE((bool)error) << i;
+                EXPECT_FALSE(aybabtu::base64::is_valid(
+                    encoded, alphabet, aybabtu::padding::disabled, simd))
+                    << i;
+            }
+        }
+    }
+}